@@ -0,0 +1,181 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "arch.c"
+  "/root/repo/cmake/Install.cmake"
+  "/root/repo/cmake/TargetArch.cmake"
+  "/root/repo/src/kiva/CMakeLists.txt"
+  "/root/repo/src/libgroundplot/CMakeLists.txt"
+  "/root/repo/src/libkiva/CMakeLists.txt"
+  "/root/repo/src/libkiva/Version.hpp.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/unit/CMakeLists.txt"
+  "/root/repo/vendor/CMakeLists.txt"
+  "/root/repo/vendor/boost-1.61.0/CMakeLists.txt"
+  "/root/repo/vendor/boost-1.61.0/boost/date_time/CMakeLists.txt"
+  "/root/repo/vendor/boost-1.61.0/boost/filesystem/CMakeLists.txt"
+  "/root/repo/vendor/boost-1.61.0/boost/program_options/CMakeLists.txt"
+  "/root/repo/vendor/boost-1.61.0/boost/system/CMakeLists.txt"
+  "/root/repo/vendor/gtest/CMakeLists.txt"
+  "/root/repo/vendor/gtest/cmake/internal_utils.cmake"
+  "/root/repo/vendor/libpng-1.6.23/CMakeLists.txt"
+  "/root/repo/vendor/libpng-1.6.23/scripts/genchk.cmake.in"
+  "/root/repo/vendor/libpng-1.6.23/scripts/genout.cmake.in"
+  "/root/repo/vendor/libpng-1.6.23/scripts/gensrc.cmake.in"
+  "/root/repo/vendor/mathgl-2.3.5.1/CMakeLists.txt"
+  "/root/repo/vendor/mathgl-2.3.5.1/include/CMakeLists.txt"
+  "/root/repo/vendor/mathgl-2.3.5.1/include/config.h.in"
+  "/root/repo/vendor/mathgl-2.3.5.1/src/CMakeLists.txt"
+  "/root/repo/vendor/yaml-cpp-0.5.3/CMakeLists.txt"
+  "/root/repo/vendor/yaml-cpp-0.5.3/yaml-cpp-config-version.cmake.in"
+  "/root/repo/vendor/yaml-cpp-0.5.3/yaml-cpp-config.cmake.in"
+  "/root/repo/vendor/zlib-1.2.8/CMakeLists.txt"
+  "/root/repo/vendor/zlib-1.2.8/zconf.h.cmakein"
+  "/root/repo/vendor/zlib-1.2.8/zlib.pc.cmakein"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/zlib-1.2.8/zlib.pc"
+  "vendor/zlib-1.2.8/zconf.h"
+  "vendor/zlib-1.2.8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/libpng-1.6.23/scripts/genchk.cmake"
+  "vendor/libpng-1.6.23/scripts/genout.cmake"
+  "vendor/libpng-1.6.23/scripts/gensrc.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/mathgl-2.3.5.1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/mathgl-2.3.5.1/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/mathgl-2.3.5.1/include/mgl2/config.h"
+  "vendor/mathgl-2.3.5.1/include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/boost-1.61.0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/boost-1.61.0/boost/filesystem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/boost-1.61.0/boost/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/boost-1.61.0/boost/date_time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/boost-1.61.0/boost/program_options/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/yaml-cpp-0.5.3/yaml-cpp-config.cmake"
+  "vendor/yaml-cpp-0.5.3/yaml-cpp-config-version.cmake"
+  "vendor/yaml-cpp-0.5.3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "vendor/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libkiva/Version.hpp"
+  "src/libkiva/libkiva_export.h"
+  "src/libkiva/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libgroundplot/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/kiva/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "vendor/zlib-1.2.8/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/symbol-check.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/genvers.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/gensym.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/genprebuilt.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/genfiles.dir/DependInfo.cmake"
+  "vendor/libpng-1.6.23/CMakeFiles/png_static.dir/DependInfo.cmake"
+  "vendor/mathgl-2.3.5.1/src/CMakeFiles/mgl-static.dir/DependInfo.cmake"
+  "vendor/boost-1.61.0/boost/filesystem/CMakeFiles/boost_filesystem.dir/DependInfo.cmake"
+  "vendor/boost-1.61.0/boost/system/CMakeFiles/boost_system.dir/DependInfo.cmake"
+  "vendor/boost-1.61.0/boost/date_time/CMakeFiles/boost_date_time.dir/DependInfo.cmake"
+  "vendor/boost-1.61.0/boost/program_options/CMakeFiles/boost_program_options.dir/DependInfo.cmake"
+  "vendor/yaml-cpp-0.5.3/CMakeFiles/debuggable.dir/DependInfo.cmake"
+  "vendor/yaml-cpp-0.5.3/CMakeFiles/releasable.dir/DependInfo.cmake"
+  "vendor/yaml-cpp-0.5.3/CMakeFiles/yaml-cpp.dir/DependInfo.cmake"
+  "vendor/yaml-cpp-0.5.3/CMakeFiles/format.dir/DependInfo.cmake"
+  "vendor/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "vendor/gtest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "src/libkiva/CMakeFiles/libkiva.dir/DependInfo.cmake"
+  "src/libgroundplot/CMakeFiles/groundplot.dir/DependInfo.cmake"
+  "src/kiva/CMakeFiles/kiva.dir/DependInfo.cmake"
+  "test/CMakeFiles/kiva_results_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/rm_results_subdirectory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_subdirectory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_slab_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_basement_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_crawlspace_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC10a_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC30a_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC30b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC30c_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC40a_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC40b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC40c_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC45b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC45c_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC50b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC55b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC55c_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC60b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC65b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC70b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC80b_directory.dir/DependInfo.cmake"
+  "test/CMakeFiles/results_GC80c_directory.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/kiva_tests.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/kiva_allocation_tests.dir/DependInfo.cmake"
+  )
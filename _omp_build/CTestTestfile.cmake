@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_omp_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("vendor")
+subdirs("src/libkiva")
+subdirs("src/libgroundplot")
+subdirs("src/kiva")
+subdirs("test")
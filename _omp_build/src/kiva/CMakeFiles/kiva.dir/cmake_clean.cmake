@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../kiva"
+  "../../kiva.pdb"
+  "CMakeFiles/kiva.dir/Input.cpp.o"
+  "CMakeFiles/kiva.dir/Input.cpp.o.d"
+  "CMakeFiles/kiva.dir/InputParser.cpp.o"
+  "CMakeFiles/kiva.dir/InputParser.cpp.o.d"
+  "CMakeFiles/kiva.dir/Main.cpp.o"
+  "CMakeFiles/kiva.dir/Main.cpp.o.d"
+  "CMakeFiles/kiva.dir/Simulator.cpp.o"
+  "CMakeFiles/kiva.dir/Simulator.cpp.o.d"
+  "CMakeFiles/kiva.dir/StateCache.cpp.o"
+  "CMakeFiles/kiva.dir/StateCache.cpp.o.d"
+  "CMakeFiles/kiva.dir/WeatherData.cpp.o"
+  "CMakeFiles/kiva.dir/WeatherData.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kiva.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
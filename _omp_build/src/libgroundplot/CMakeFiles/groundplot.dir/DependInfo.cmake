@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libgroundplot/GroundPlot.cpp" "src/libgroundplot/CMakeFiles/groundplot.dir/GroundPlot.cpp.o" "gcc" "src/libgroundplot/CMakeFiles/groundplot.dir/GroundPlot.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/vendor/boost-1.61.0/boost/filesystem/CMakeFiles/boost_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/boost-1.61.0/boost/system/CMakeFiles/boost_system.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/mathgl-2.3.5.1/src/CMakeFiles/mgl-static.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/src/libkiva/CMakeFiles/libkiva.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/libpng-1.6.23/CMakeFiles/png_static.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/zlib-1.2.8/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
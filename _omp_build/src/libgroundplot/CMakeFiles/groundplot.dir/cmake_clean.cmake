@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libgroundplot.a"
+  "../../libgroundplot.pdb"
+  "CMakeFiles/groundplot.dir/GroundPlot.cpp.o"
+  "CMakeFiles/groundplot.dir/GroundPlot.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/groundplot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libkiva/Aggregator.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Aggregator.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Aggregator.cpp.o.d"
+  "/root/repo/src/libkiva/Algorithms.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Algorithms.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Algorithms.cpp.o.d"
+  "/root/repo/src/libkiva/Cell.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Cell.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Cell.cpp.o.d"
+  "/root/repo/src/libkiva/Domain.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Domain.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Domain.cpp.o.d"
+  "/root/repo/src/libkiva/Errors.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Errors.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Errors.cpp.o.d"
+  "/root/repo/src/libkiva/Foundation.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Foundation.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Foundation.cpp.o.d"
+  "/root/repo/src/libkiva/Functions.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Functions.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Functions.cpp.o.d"
+  "/root/repo/src/libkiva/Geometry.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Geometry.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Geometry.cpp.o.d"
+  "/root/repo/src/libkiva/Ground.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Ground.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Ground.cpp.o.d"
+  "/root/repo/src/libkiva/Instance.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Instance.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Instance.cpp.o.d"
+  "/root/repo/src/libkiva/LinearSolver.cpp" "src/libkiva/CMakeFiles/libkiva.dir/LinearSolver.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/LinearSolver.cpp.o.d"
+  "/root/repo/src/libkiva/MemoryReport.cpp" "src/libkiva/CMakeFiles/libkiva.dir/MemoryReport.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/MemoryReport.cpp.o.d"
+  "/root/repo/src/libkiva/Mesher.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Mesher.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Mesher.cpp.o.d"
+  "/root/repo/src/libkiva/Multigrid.cpp" "src/libkiva/CMakeFiles/libkiva.dir/Multigrid.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/Multigrid.cpp.o.d"
+  "/root/repo/src/libkiva/StateIO.cpp" "src/libkiva/CMakeFiles/libkiva.dir/StateIO.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/StateIO.cpp.o.d"
+  "/root/repo/src/libkiva/StencilOperator.cpp" "src/libkiva/CMakeFiles/libkiva.dir/StencilOperator.cpp.o" "gcc" "src/libkiva/CMakeFiles/libkiva.dir/StencilOperator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
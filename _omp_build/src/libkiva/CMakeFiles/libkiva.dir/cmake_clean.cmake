@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "../../libkiva.a"
+  "../../liblibkiva.pdb"
+  "CMakeFiles/libkiva.dir/Aggregator.cpp.o"
+  "CMakeFiles/libkiva.dir/Aggregator.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Algorithms.cpp.o"
+  "CMakeFiles/libkiva.dir/Algorithms.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Cell.cpp.o"
+  "CMakeFiles/libkiva.dir/Cell.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Domain.cpp.o"
+  "CMakeFiles/libkiva.dir/Domain.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Errors.cpp.o"
+  "CMakeFiles/libkiva.dir/Errors.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Foundation.cpp.o"
+  "CMakeFiles/libkiva.dir/Foundation.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Functions.cpp.o"
+  "CMakeFiles/libkiva.dir/Functions.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Geometry.cpp.o"
+  "CMakeFiles/libkiva.dir/Geometry.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Ground.cpp.o"
+  "CMakeFiles/libkiva.dir/Ground.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Instance.cpp.o"
+  "CMakeFiles/libkiva.dir/Instance.cpp.o.d"
+  "CMakeFiles/libkiva.dir/LinearSolver.cpp.o"
+  "CMakeFiles/libkiva.dir/LinearSolver.cpp.o.d"
+  "CMakeFiles/libkiva.dir/MemoryReport.cpp.o"
+  "CMakeFiles/libkiva.dir/MemoryReport.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Mesher.cpp.o"
+  "CMakeFiles/libkiva.dir/Mesher.cpp.o.d"
+  "CMakeFiles/libkiva.dir/Multigrid.cpp.o"
+  "CMakeFiles/libkiva.dir/Multigrid.cpp.o.d"
+  "CMakeFiles/libkiva.dir/StateIO.cpp.o"
+  "CMakeFiles/libkiva.dir/StateIO.cpp.o.d"
+  "CMakeFiles/libkiva.dir/StencilOperator.cpp.o"
+  "CMakeFiles/libkiva.dir/StencilOperator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libkiva.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
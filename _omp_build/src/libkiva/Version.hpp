@@ -0,0 +1,15 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef VERSION_HPP
+#define VERSION_HPP
+
+namespace Kiva {
+
+std::string getVersion() { return "v0.6.1+master.9552637.unknown-build-number (linux-gnu-64bit)"; };
+
+std::string getYear() { return "2026"; };
+
+} // namespace Kiva
+
+#endif // VERSION_HPP
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kiva_results_directory"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/kiva_results_directory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/results_GC30a_directory"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/results_GC30a_directory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
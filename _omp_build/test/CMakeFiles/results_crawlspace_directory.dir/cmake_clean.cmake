@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/results_crawlspace_directory"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/results_crawlspace_directory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
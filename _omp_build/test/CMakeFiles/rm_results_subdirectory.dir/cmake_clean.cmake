@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rm_results_subdirectory"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/rm_results_subdirectory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_omp_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(integration.example.slab "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/examples/slab.yaml" "/root/repo/weather/USA_DC_Washington.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.example.slab/out.csv")
+set_tests_properties(integration.example.slab PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;21;add_test;/root/repo/test/CMakeLists.txt;50;add_example_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.example.basement "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/examples/basement.yaml" "/root/repo/weather/USA_IL_Chicago.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.example.basement/out.csv")
+set_tests_properties(integration.example.basement PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;21;add_test;/root/repo/test/CMakeLists.txt;51;add_example_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.example.crawlspace "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/examples/crawlspace.yaml" "/root/repo/weather/USA_FL_Tampa.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.example.crawlspace/out.csv")
+set_tests_properties(integration.example.crawlspace PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;21;add_test;/root/repo/test/CMakeLists.txt;52;add_example_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC10a "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC10a.yaml" "/root/repo/test/bestest/weather/GCSS-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC10a/out.csv")
+set_tests_properties(integration.BESTEST.GC10a PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;54;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC30a "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC30a.yaml" "/root/repo/test/bestest/weather/GCSS-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC30a/out.csv")
+set_tests_properties(integration.BESTEST.GC30a PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;55;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC30b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC30b.yaml" "/root/repo/test/bestest/weather/GCSS-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC30b/out.csv")
+set_tests_properties(integration.BESTEST.GC30b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;56;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC30c "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC30c.yaml" "/root/repo/test/bestest/weather/GCSS-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC30c/out.csv")
+set_tests_properties(integration.BESTEST.GC30c PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;57;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC40a "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC40a.yaml" "/root/repo/test/bestest/weather/GCSP-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC40a/out.csv")
+set_tests_properties(integration.BESTEST.GC40a PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;58;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC40b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC40b.yaml" "/root/repo/test/bestest/weather/GCSP-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC40b/out.csv")
+set_tests_properties(integration.BESTEST.GC40b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;59;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC40c "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC40c.yaml" "/root/repo/test/bestest/weather/GCSP-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC40c/out.csv")
+set_tests_properties(integration.BESTEST.GC40c PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;60;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC45b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC45b.yaml" "/root/repo/test/bestest/weather/GCSP-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC45b/out.csv")
+set_tests_properties(integration.BESTEST.GC45b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;61;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC45c "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC45c.yaml" "/root/repo/test/bestest/weather/GCSP-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC45c/out.csv")
+set_tests_properties(integration.BESTEST.GC45c PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;62;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC50b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC50b.yaml" "/root/repo/test/bestest/weather/GCSP-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC50b/out.csv")
+set_tests_properties(integration.BESTEST.GC50b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;63;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC55b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC55b.yaml" "/root/repo/test/bestest/weather/GCSP-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC55b/out.csv")
+set_tests_properties(integration.BESTEST.GC55b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;64;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC55c "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC55c.yaml" "/root/repo/test/bestest/weather/GCSP-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC55c/out.csv")
+set_tests_properties(integration.BESTEST.GC55c PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;65;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC60b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC60b.yaml" "/root/repo/test/bestest/weather/GCSS-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC60b/out.csv")
+set_tests_properties(integration.BESTEST.GC60b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;66;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC65b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC65b.yaml" "/root/repo/test/bestest/weather/GCSS-W01TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC65b/out.csv")
+set_tests_properties(integration.BESTEST.GC65b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;67;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC70b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC70b.yaml" "/root/repo/test/bestest/weather/GCSP-W01TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC70b/out.csv")
+set_tests_properties(integration.BESTEST.GC70b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;68;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC80b "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC80b.yaml" "/root/repo/test/bestest/weather/GCSP-W20TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC80b/out.csv")
+set_tests_properties(integration.BESTEST.GC80b PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;69;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.BESTEST.GC80c "ruby" "run-kiva.rb" "/root/repo/_omp_build/kiva" "/root/repo/test/bestest/GC80c.yaml" "/root/repo/test/bestest/weather/GCSP-W40TM2.epw" "/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.BESTEST.GC80c/out.csv")
+set_tests_properties(integration.BESTEST.GC80c PROPERTIES  WORKING_DIRECTORY "/root/repo/scripts" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;40;add_test;/root/repo/test/CMakeLists.txt;70;add_bestest_case;/root/repo/test/CMakeLists.txt;0;")
+add_test(integration.stateCache "/usr/bin/cmake" "-DKIVA=/root/repo/_omp_build/kiva" "-DINPUT=/root/repo/examples/slab.yaml" "-DWEATHER=/root/repo/weather/USA_DC_Washington.epw" "-DWORK_DIR=/root/repo/_omp_build/test/results/linux-gnu-64bit/integration.stateCache" "-P" "/root/repo/scripts/check-state-cache.cmake")
+set_tests_properties(integration.stateCache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;72;add_test;/root/repo/test/CMakeLists.txt;0;")
+subdirs("unit")
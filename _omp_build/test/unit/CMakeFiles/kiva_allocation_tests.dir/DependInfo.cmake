@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/allocation_test.cpp" "test/unit/CMakeFiles/kiva_allocation_tests.dir/allocation_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_allocation_tests.dir/allocation_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/vendor/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/gtest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/src/libkiva/CMakeFiles/libkiva.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../kiva_allocation_tests"
+  "../../kiva_allocation_tests.pdb"
+  "CMakeFiles/kiva_allocation_tests.dir/allocation_test.cpp.o"
+  "CMakeFiles/kiva_allocation_tests.dir/allocation_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kiva_allocation_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
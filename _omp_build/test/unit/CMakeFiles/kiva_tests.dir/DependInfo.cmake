@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/kiva/StateCache.cpp" "test/unit/CMakeFiles/kiva_tests.dir/__/__/src/kiva/StateCache.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/__/__/src/kiva/StateCache.cpp.o.d"
+  "/root/repo/test/unit/cell_test.cpp" "test/unit/CMakeFiles/kiva_tests.dir/cell_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/cell_test.cpp.o.d"
+  "/root/repo/test/unit/domain_test.cpp" "test/unit/CMakeFiles/kiva_tests.dir/domain_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/domain_test.cpp.o.d"
+  "/root/repo/test/unit/foundation.unit.cpp" "test/unit/CMakeFiles/kiva_tests.dir/foundation.unit.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/foundation.unit.cpp.o.d"
+  "/root/repo/test/unit/functions_test.cpp" "test/unit/CMakeFiles/kiva_tests.dir/functions_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/functions_test.cpp.o.d"
+  "/root/repo/test/unit/ground_test.cpp" "test/unit/CMakeFiles/kiva_tests.dir/ground_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/ground_test.cpp.o.d"
+  "/root/repo/test/unit/state_cache_test.cpp" "test/unit/CMakeFiles/kiva_tests.dir/state_cache_test.cpp.o" "gcc" "test/unit/CMakeFiles/kiva_tests.dir/state_cache_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/vendor/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/src/libkiva/CMakeFiles/libkiva.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/boost-1.61.0/boost/filesystem/CMakeFiles/boost_filesystem.dir/DependInfo.cmake"
+  "/root/repo/_omp_build/vendor/boost-1.61.0/boost/system/CMakeFiles/boost_system.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../kiva_tests"
+  "../../kiva_tests.pdb"
+  "CMakeFiles/kiva_tests.dir/__/__/src/kiva/StateCache.cpp.o"
+  "CMakeFiles/kiva_tests.dir/__/__/src/kiva/StateCache.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/cell_test.cpp.o"
+  "CMakeFiles/kiva_tests.dir/cell_test.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/domain_test.cpp.o"
+  "CMakeFiles/kiva_tests.dir/domain_test.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/foundation.unit.cpp.o"
+  "CMakeFiles/kiva_tests.dir/foundation.unit.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/functions_test.cpp.o"
+  "CMakeFiles/kiva_tests.dir/functions_test.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/ground_test.cpp.o"
+  "CMakeFiles/kiva_tests.dir/ground_test.cpp.o.d"
+  "CMakeFiles/kiva_tests.dir/state_cache_test.cpp.o"
+  "CMakeFiles/kiva_tests.dir/state_cache_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kiva_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
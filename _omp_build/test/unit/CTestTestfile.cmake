@@ -0,0 +1,124 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit
+# Build directory: /root/repo/_omp_build/test/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit.GC10aFixture.calculateADI "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateADI")
+set_tests_properties(unit.GC10aFixture.calculateADI PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;30;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicit "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicit")
+set_tests_properties(unit.GC10aFixture.calculateImplicit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;31;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitReusedPreconditioner "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitReusedPreconditioner")
+set_tests_properties(unit.GC10aFixture.calculateImplicitReusedPreconditioner PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;32;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitSparseLU "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitSparseLU")
+set_tests_properties(unit.GC10aFixture.calculateImplicitSparseLU PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;33;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitGMRES "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitGMRES")
+set_tests_properties(unit.GC10aFixture.calculateImplicitGMRES PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;34;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitJacobi "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitJacobi")
+set_tests_properties(unit.GC10aFixture.calculateImplicitJacobi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;35;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitMatrixFree "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitMatrixFree")
+set_tests_properties(unit.GC10aFixture.calculateImplicitMatrixFree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;36;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateImplicitMultigrid "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateImplicitMultigrid")
+set_tests_properties(unit.GC10aFixture.calculateImplicitMultigrid PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;37;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateExplicit "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateExplicit")
+set_tests_properties(unit.GC10aFixture.calculateExplicit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;38;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateCrankN "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateCrankN")
+set_tests_properties(unit.GC10aFixture.calculateCrankN PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;39;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateADE "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateADE")
+set_tests_properties(unit.GC10aFixture.calculateADE PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;40;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.GC10a_calculateSteadyState "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.GC10a_calculateSteadyState")
+set_tests_properties(unit.GC10aFixture.GC10a_calculateSteadyState PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;41;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.GC10a_calculateSteadyStateConverged "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.GC10a_calculateSteadyStateConverged")
+set_tests_properties(unit.GC10aFixture.GC10a_calculateSteadyStateConverged PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;42;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateADEConvergedInitialization "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateADEConvergedInitialization")
+set_tests_properties(unit.GC10aFixture.calculateADEConvergedInitialization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;43;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.GC10a_calculateSteadyStateMultigrid "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.GC10a_calculateSteadyStateMultigrid")
+set_tests_properties(unit.GC10aFixture.GC10a_calculateSteadyStateMultigrid PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;44;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calcCellADI "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calcCellADI")
+set_tests_properties(unit.GC10aFixture.calcCellADI PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;45;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calcCellMatrix "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calcCellMatrix")
+set_tests_properties(unit.GC10aFixture.calcCellMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;46;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calcCellMatrixSS "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calcCellMatrixSS")
+set_tests_properties(unit.GC10aFixture.calcCellMatrixSS PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;47;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calcCellExplicitExteriorFlux "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calcCellExplicitExteriorFlux")
+set_tests_properties(unit.GC10aFixture.calcCellExplicitExteriorFlux PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;48;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC10a "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC10a")
+set_tests_properties(unit.BESTEST.GC10a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;50;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC30a "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC30a")
+set_tests_properties(unit.BESTEST.GC30a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;51;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC30b "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC30b")
+set_tests_properties(unit.BESTEST.GC30b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;52;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC30c "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC30c")
+set_tests_properties(unit.BESTEST.GC30c PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;53;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC60b "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC60b")
+set_tests_properties(unit.BESTEST.GC60b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;54;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.GC65b "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.GC65b")
+set_tests_properties(unit.BESTEST.GC65b PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;55;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.BESTEST.1D "/root/repo/_omp_build/kiva_tests" "--gtest_filter=BESTESTFixture.1D")
+set_tests_properties(unit.BESTEST.1D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;56;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.domain_basics "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.domain_basics")
+set_tests_properties(unit.DomainFixture.domain_basics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;58;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.surface_indices "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.surface_indices")
+set_tests_properties(unit.DomainFixture.surface_indices PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;59;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.surface_tilt "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.surface_tilt")
+set_tests_properties(unit.DomainFixture.surface_tilt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;60;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.cell_vector "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.cell_vector")
+set_tests_properties(unit.DomainFixture.cell_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;61;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.cell_partitions "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.cell_partitions")
+set_tests_properties(unit.DomainFixture.cell_partitions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;62;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.DomainFixture.active_cells "/root/repo/_omp_build/kiva_tests" "--gtest_filter=DomainFixture.active_cells")
+set_tests_properties(unit.DomainFixture.active_cells PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;63;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.CellFixture.cell_basics "/root/repo/_omp_build/kiva_tests" "--gtest_filter=CellFixture.cell_basics")
+set_tests_properties(unit.CellFixture.cell_basics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;65;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.StateCacheFixture.storeAndLoad "/root/repo/_omp_build/kiva_tests" "--gtest_filter=StateCacheFixture.storeAndLoad")
+set_tests_properties(unit.StateCacheFixture.storeAndLoad PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;68;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.StateCacheFixture.evictLeastRecentlyUsed "/root/repo/_omp_build/kiva_tests" "--gtest_filter=StateCacheFixture.evictLeastRecentlyUsed")
+set_tests_properties(unit.StateCacheFixture.evictLeastRecentlyUsed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;69;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.counter "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.counter")
+set_tests_properties(unit.AllocationFixture.counter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;73;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateADE "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateADE")
+set_tests_properties(unit.AllocationFixture.calculateADE PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;74;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateADI "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateADI")
+set_tests_properties(unit.AllocationFixture.calculateADI PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;75;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateExplicit "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateExplicit")
+set_tests_properties(unit.AllocationFixture.calculateExplicit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;76;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateImplicit "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateImplicit")
+set_tests_properties(unit.AllocationFixture.calculateImplicit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;77;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateCrankN "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateCrankN")
+set_tests_properties(unit.AllocationFixture.calculateCrankN PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;78;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.calculateImplicitMatrixFree "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.calculateImplicitMatrixFree")
+set_tests_properties(unit.AllocationFixture.calculateImplicitMatrixFree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;79;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AllocationFixture.swapTemperatures "/root/repo/_omp_build/kiva_allocation_tests" "--gtest_filter=AllocationFixture.swapTemperatures")
+set_tests_properties(unit.AllocationFixture.swapTemperatures PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;80;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.memoryReport "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.memoryReport")
+set_tests_properties(unit.GC10aFixture.memoryReport PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;82;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.memoryReportWithoutMatrix "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.memoryReportWithoutMatrix")
+set_tests_properties(unit.GC10aFixture.memoryReportWithoutMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;83;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculateAdaptive "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculateAdaptive")
+set_tests_properties(unit.GC10aFixture.calculateAdaptive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;84;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.TypicalFixture.calculateExplicitStability "/root/repo/_omp_build/kiva_tests" "--gtest_filter=TypicalFixture.calculateExplicitStability")
+set_tests_properties(unit.TypicalFixture.calculateExplicitStability PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;85;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.outputValuesMapInterface "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.outputValuesMapInterface")
+set_tests_properties(unit.GC10aFixture.outputValuesMapInterface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;86;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.calculatePeriodic "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.calculatePeriodic")
+set_tests_properties(unit.GC10aFixture.calculatePeriodic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;87;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.interpolateTemperatures "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.interpolateTemperatures")
+set_tests_properties(unit.GC10aFixture.interpolateTemperatures PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;88;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.GC10aFixture.writeAndReadState "/root/repo/_omp_build/kiva_tests" "--gtest_filter=GC10aFixture.writeAndReadState")
+set_tests_properties(unit.GC10aFixture.writeAndReadState PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;89;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.TypicalFixture.writeAndReadStateReusedPreconditioner "/root/repo/_omp_build/kiva_tests" "--gtest_filter=TypicalFixture.writeAndReadStateReusedPreconditioner")
+set_tests_properties(unit.TypicalFixture.writeAndReadStateReusedPreconditioner PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;90;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.TypicalFixture.writeAndReadStateAdaptive "/root/repo/_omp_build/kiva_tests" "--gtest_filter=TypicalFixture.writeAndReadStateAdaptive")
+set_tests_properties(unit.TypicalFixture.writeAndReadStateAdaptive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;91;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.FunctionsTest.solveTDMBatch "/root/repo/_omp_build/kiva_tests" "--gtest_filter=FunctionsTest.solveTDMBatch")
+set_tests_properties(unit.FunctionsTest.solveTDMBatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;93;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.FunctionsTest.interleavedLineIndex "/root/repo/_omp_build/kiva_tests" "--gtest_filter=FunctionsTest.interleavedLineIndex")
+set_tests_properties(unit.FunctionsTest.interleavedLineIndex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;94;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.AggregatorFixture.validation "/root/repo/_omp_build/kiva_tests" "--gtest_filter=AggregatorFixture.validation")
+set_tests_properties(unit.AggregatorFixture.validation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;96;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.TypicalFixture.convectionCallback "/root/repo/_omp_build/kiva_tests" "--gtest_filter=TypicalFixture.convectionCallback")
+set_tests_properties(unit.TypicalFixture.convectionCallback PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;98;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.FoundationFixture.foundationSurfaces "/root/repo/_omp_build/kiva_tests" "--gtest_filter=FoundationFixture.foundationSurfaces")
+set_tests_properties(unit.FoundationFixture.foundationSurfaces PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;100;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(unit.FoundationFixture.foundationSurfaces2 "/root/repo/_omp_build/kiva_tests" "--gtest_filter=FoundationFixture.foundationSurfaces2")
+set_tests_properties(unit.FoundationFixture.foundationSurfaces2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;101;add_test;/root/repo/test/unit/CMakeLists.txt;0;")
@@ -0,0 +1,37 @@
+# Runs Kiva twice with the same cache directory and checks that the second run loads its initial
+# temperatures from the cache instead of initializing them, with the same results.
+#
+#   cmake -DKIVA=<exe> -DINPUT=<yaml> -DWEATHER=<epw> -DWORK_DIR=<dir> -P check-state-cache.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# A one day simulation, so the run is mostly initialization
+file(READ ${INPUT} input)
+string(REGEX REPLACE "End Date: [^\n]*" "End Date: 2015-Jan-1" input "${input}")
+file(WRITE ${WORK_DIR}/in.yaml "${input}")
+
+foreach(run 1 2)
+  execute_process(COMMAND ${KIVA} in.yaml ${WEATHER} out${run}.csv --cache-dir cache
+                  WORKING_DIRECTORY ${WORK_DIR}
+                  RESULT_VARIABLE result
+                  OUTPUT_VARIABLE output${run}
+                  ERROR_VARIABLE output${run})
+  if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Run ${run} failed:\n${output${run}}")
+  endif()
+endforeach()
+
+if (NOT output1 MATCHES "Initializing Temperatures")
+  message(FATAL_ERROR "The first run did not initialize temperatures:\n${output1}")
+endif()
+if (output2 MATCHES "Initializing Temperatures" OR NOT output2 MATCHES "loaded from the cache")
+  message(FATAL_ERROR "The second run did not load its initial temperatures from the cache:\n"
+                      "${output2}")
+endif()
+
+file(READ ${WORK_DIR}/out1.csv results1)
+file(READ ${WORK_DIR}/out2.csv results2)
+if (NOT results1 STREQUAL results2)
+  message(FATAL_ERROR "The results of the cached run differ from the initialized run.")
+endif()
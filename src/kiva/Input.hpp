@@ -29,6 +29,7 @@ public:
   boost::gregorian::date startDate;
   boost::gregorian::date endDate;
   boost::posix_time::time_duration timestep;
+  boost::posix_time::time_duration maximumTimestep; // adaptive timesteps if longer than timestep
   std::string weatherFile;
   boost::posix_time::ptime startTime;
 
@@ -38,11 +39,17 @@ public:
 class Initialization {
 public:
   double initialTemperature;
-  enum InitializationMethod { IM_KUSUDA, IM_CONSTANT_TEMPERATURE, IM_STEADY_STATE };
+  enum InitializationMethod { IM_KUSUDA, IM_CONSTANT_TEMPERATURE, IM_STEADY_STATE, IM_PERIODIC };
 
   long warmupDays;
   long implicitAccelTimestep;
   long implicitAccelPeriods;
+  long periodicHarmonics; // annual harmonics of the periodic initialization
+
+  // Initialization on a mesh with cells this many times larger (if greater than 1), except for the
+  // last settling days of the warmup
+  double coarseMeshFactor;
+  long fineMeshSettlingDays;
 
   InitializationMethod initializationMethod;
 };
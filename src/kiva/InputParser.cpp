@@ -24,6 +24,12 @@ Input inputParser(std::string inputFile) {
       boost::gregorian::from_string(yamlInput["Simulation Control"]["End Date"].as<std::string>());
   simulationControl.timestep =
       boost::posix_time::minutes(yamlInput["Simulation Control"]["Timestep"].as<long>());
+  if (yamlInput["Simulation Control"]["Maximum Timestep"].IsDefined()) {
+    simulationControl.maximumTimestep =
+        boost::posix_time::minutes(yamlInput["Simulation Control"]["Maximum Timestep"].as<long>());
+  } else {
+    simulationControl.maximumTimestep = simulationControl.timestep;
+  }
 
   // MATERIALS
   std::map<std::string, Material> materials;
@@ -486,6 +492,47 @@ Input inputParser(std::string inputFile) {
     foundation.tolerance = 1.0e-6;
   }
 
+  if (yamlInput["Numerical Settings"]["Linear Solver"].IsDefined()) {
+    if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() == "BICGSTAB-ILUT")
+      foundation.linearSolver = Foundation::LS_BICGSTAB_ILUT;
+    else if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() ==
+             "BICGSTAB-JACOBI")
+      foundation.linearSolver = Foundation::LS_BICGSTAB_JACOBI;
+    else if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() == "GMRES-ILUT")
+      foundation.linearSolver = Foundation::LS_GMRES_ILUT;
+    else if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() == "SPARSE-LU")
+      foundation.linearSolver = Foundation::LS_SPARSE_LU;
+    else if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() ==
+             "BICGSTAB-MATRIX-FREE")
+      foundation.linearSolver = Foundation::LS_BICGSTAB_MATRIX_FREE;
+    else if (yamlInput["Numerical Settings"]["Linear Solver"].as<std::string>() ==
+             "BICGSTAB-MULTIGRID")
+      foundation.linearSolver = Foundation::LS_BICGSTAB_MULTIGRID;
+  } else {
+    foundation.linearSolver = Foundation::LS_BICGSTAB_ILUT;
+  }
+
+  if (yamlInput["Numerical Settings"]["Preconditioner Refresh Interval"].IsDefined()) {
+    foundation.preconditionerRefreshInterval =
+        yamlInput["Numerical Settings"]["Preconditioner Refresh Interval"].as<int>();
+  } else {
+    foundation.preconditionerRefreshInterval = 0;
+  }
+
+  if (yamlInput["Numerical Settings"]["Preconditioner Iteration Growth"].IsDefined()) {
+    foundation.preconditionerIterationGrowth =
+        yamlInput["Numerical Settings"]["Preconditioner Iteration Growth"].as<double>();
+  } else {
+    foundation.preconditionerIterationGrowth = 0.0;
+  }
+
+  if (yamlInput["Numerical Settings"]["Adaptive Timestep Tolerance"].IsDefined()) {
+    foundation.adaptiveTimestepTolerance =
+        yamlInput["Numerical Settings"]["Adaptive Timestep Tolerance"].as<double>();
+  } else {
+    foundation.adaptiveTimestepTolerance = 0.1;
+  }
+
   // BOUNDARIES
   if (yamlInput["Boundaries"]["Far-Field Width"].IsDefined()) {
     foundation.farFieldWidth = yamlInput["Boundaries"]["Far-Field Width"].as<double>();
@@ -606,6 +653,8 @@ Input inputParser(std::string inputFile) {
     else if (yamlInput["Initialization"]["Initialization Method"].as<std::string>() ==
              "STEADY-STATE")
       initialization.initializationMethod = Initialization::IM_STEADY_STATE;
+    else if (yamlInput["Initialization"]["Initialization Method"].as<std::string>() == "PERIODIC")
+      initialization.initializationMethod = Initialization::IM_PERIODIC;
     else if (yamlInput["Initialization"]["Initialization Method"].as<std::string>() == "CONSTANT") {
       initialization.initializationMethod = Initialization::IM_CONSTANT_TEMPERATURE;
       initialization.initialTemperature =
@@ -615,6 +664,16 @@ Input inputParser(std::string inputFile) {
     initialization.initializationMethod = Initialization::IM_STEADY_STATE;
   }
 
+  // The periodic solution replaces the accelerated initialization and most of the warmup
+  const bool periodic = initialization.initializationMethod == Initialization::IM_PERIODIC;
+
+  if (yamlInput["Initialization"]["Number of Periodic Harmonics"].IsDefined()) {
+    initialization.periodicHarmonics =
+        yamlInput["Initialization"]["Number of Periodic Harmonics"].as<long>();
+  } else {
+    initialization.periodicHarmonics = 4;
+  }
+
   if (yamlInput["Initialization"]["Accelerated Initialization Timestep"].IsDefined()) {
     initialization.implicitAccelTimestep =
         yamlInput["Initialization"]["Accelerated Initialization Timestep"].as<long>();
@@ -626,14 +685,28 @@ Input inputParser(std::string inputFile) {
     initialization.implicitAccelPeriods =
         yamlInput["Initialization"]["Number of Accelearted Initialization Timesteps"].as<long>();
   } else {
-    initialization.implicitAccelPeriods = 12;
+    initialization.implicitAccelPeriods = periodic ? 0 : 12;
   }
 
   if (yamlInput["Initialization"]["Number of Warmup Days in Initialization"].IsDefined()) {
     initialization.warmupDays =
         yamlInput["Initialization"]["Number of Warmup Days in Initialization"].as<long>();
   } else {
-    initialization.warmupDays = 365;
+    initialization.warmupDays = periodic ? 7 : 365;
+  }
+
+  if (yamlInput["Initialization"]["Coarse Mesh Factor"].IsDefined()) {
+    initialization.coarseMeshFactor =
+        yamlInput["Initialization"]["Coarse Mesh Factor"].as<double>();
+  } else {
+    initialization.coarseMeshFactor = 1.0;
+  }
+
+  if (yamlInput["Initialization"]["Number of Fine Mesh Settling Days"].IsDefined()) {
+    initialization.fineMeshSettlingDays =
+        yamlInput["Initialization"]["Number of Fine Mesh Settling Days"].as<long>();
+  } else {
+    initialization.fineMeshSettlingDays = 14;
   }
 
   // OUTPUT
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -12,6 +13,7 @@
 #include "Errors.hpp"
 #include "InputParser.hpp"
 #include "Simulator.hpp"
+#include "StateCache.hpp"
 #include "Version.hpp"
 #include "WeatherData.hpp"
 #include "libkiva_export.h"
@@ -47,7 +49,18 @@ int main(int argc, char *argv[]) {
 
     po::options_description generic("Options");
     generic.add_options()("help,h", "Produce this message")("version,v",
-                                                            "Display version information");
+                                                            "Display version information")(
+        "memory,m", "Print memory usage after creating the domain and after the simulation")(
+        "cache-dir,c", po::value<std::string>(),
+        "Save initial temperatures in this directory, and reuse them in runs with the same "
+        "foundation, boundary conditions, initialization and weather")(
+        "cache-entries", po::value<int>()->default_value(20),
+        "Number of initial temperature states kept in the cache directory (the least recently "
+        "used are removed)")(
+        "checkpoint", po::value<std::string>(),
+        "Write checkpoints to this file during the simulation, and resume from it if it exists")(
+        "checkpoint-interval", po::value<int>()->default_value(30),
+        "Days of simulated time between checkpoints");
 
     po::options_description hidden("Hidden options");
     hidden.add_options()("input-file", po::value<std::string>(),
@@ -90,8 +103,28 @@ int main(int argc, char *argv[]) {
 
       input.simulationControl.setStartTime();
 
+      std::unique_ptr<StateCache> stateCache;
+      if (vm.count("cache-dir")) {
+        if (vm["cache-entries"].as<int>() < 1) {
+          Kiva::showMessage(MSG_ERR, "The number of cache entries must be at least 1.");
+        }
+        stateCache.reset(new StateCache(vm["cache-dir"].as<std::string>(),
+                                        vm["cache-entries"].as<int>(), versionInfo));
+      }
+
+      CheckpointSettings checkpoint;
+      if (vm.count("checkpoint")) {
+        if (vm["checkpoint-interval"].as<int>() < 1) {
+          Kiva::showMessage(MSG_ERR, "The checkpoint interval must be at least 1 day.");
+        }
+        checkpoint.fileName = vm["checkpoint"].as<std::string>();
+        checkpoint.interval = boost::posix_time::hours(24 * vm["checkpoint-interval"].as<int>());
+        checkpoint.version = versionInfo;
+      }
+
       // initialize
-      Simulator simulator(weather, input, vm["output-file"].as<std::string>());
+      Simulator simulator(weather, input, vm["output-file"].as<std::string>(),
+                          vm.count("memory") > 0, stateCache.get(), checkpoint);
 
       simulator.simulate();
 
@@ -3,19 +3,26 @@
 
 #include "Simulator.hpp"
 #include "Errors.hpp"
+#include "StateIO.hpp"
 
 using namespace Kiva;
 
 static const double PI = 4.0 * atan(1.0);
 
-Simulator::Simulator(WeatherData &weatherData, Input &input, std::string outputFileName)
-    : weatherData(weatherData), input(input),
-      ground(input.foundation, input.output.outputReport.outputMap) {
-  // set up output file
-  boost::filesystem::path outputPath(outputFileName);
+Simulator::Simulator(WeatherData &weatherData, Input &input, std::string outputFileName,
+                     bool reportMemory, StateCache *stateCache,
+                     const CheckpointSettings &checkpoint)
+    : weatherData(weatherData), input(input), reportMemory(reportMemory), stateCache(stateCache),
+      checkpoint(checkpoint), ground(input.foundation, input.output.outputReport.outputMap) {
+  // set up output file (a resumed run continues it after reading the checkpoint)
+  outputPath = outputFileName;
   outputDir = outputPath.parent_path();
-  outputFile.open(outputFileName.c_str());
-  outputFile << "Timestamp" << printOutputHeaders() << std::endl;
+  const bool resuming =
+      !checkpoint.fileName.empty() && boost::filesystem::exists(checkpoint.fileName);
+  if (!resuming) {
+    outputFile.open(outputFileName.c_str());
+    outputFile << "Timestamp" << printOutputHeaders() << std::endl;
+  }
 
   annualAverageDryBulbTemperature = weatherData.dryBulbTemp.getAverage();
 
@@ -35,6 +42,19 @@ Simulator::Simulator(WeatherData &weatherData, Input &input, std::string outputF
     ground.setNewBoundaryGeometry();
   }
 
+  if (input.initialization.coarseMeshFactor > 1.0) {
+    // Copied before the domain is built (which adds the derived blocks and surfaces). The
+    // smallest cells are larger, and grow faster away from the surfaces.
+    const double factor = input.initialization.coarseMeshFactor;
+    coarseFoundation = input.foundation;
+    Mesh &mesh = coarseFoundation.mesh;
+    mesh.minCellDim *= factor;
+    for (double *growthCoeff : {&mesh.maxNearGrowthCoeff, &mesh.maxDepthGrowthCoeff,
+                                &mesh.maxInteriorGrowthCoeff, &mesh.maxExteriorGrowthCoeff}) {
+      *growthCoeff = 1.0 + (*growthCoeff - 1.0) * factor;
+    }
+  }
+
   ground.buildDomain();
 
   std::stringstream ss;
@@ -46,10 +66,18 @@ Simulator::Simulator(WeatherData &weatherData, Input &input, std::string outputF
 
   showMessage(MSG_INFO, ss.str());
 
-  // Initial Conditions
-  initializeConditions();
+  if (reportMemory) {
+    printMemoryReport("Domain");
+  }
 
   initializePlots();
+
+  // Initial Conditions
+  if (resuming) {
+    readCheckpoint();
+  } else {
+    initializeConditions();
+  }
 }
 
 Simulator::~Simulator() { outputFile.close(); }
@@ -63,77 +91,456 @@ void Simulator::initializeConditions() {
   if (input.foundation.numericalScheme !=
       Foundation::NS_STEADY_STATE) // Intialization not necessary for steady state calculations
   {
-    showMessage(MSG_INFO, "Initializing Temperatures...");
-
-    // Calculate initial time in seconds (simulation start minus warmup and acceleration periods)
-    boost::posix_time::time_duration &simulationTimestep = input.simulationControl.timestep;
-    boost::posix_time::time_duration accelTimestep =
-        boost::posix_time::hours(input.initialization.implicitAccelTimestep);
-
-    boost::posix_time::time_duration accelDuration =
-        accelTimestep * input.initialization.implicitAccelPeriods;
-    boost::posix_time::time_duration warmupDuration =
-        boost::posix_time::hours(input.initialization.warmupDays * 24);
-
-    boost::posix_time::ptime tInit = input.simulationControl.startTime - warmupDuration -
-                                     simulationTimestep - accelDuration - accelTimestep;
-
-    // Calculate initial conditions
-    if (input.initialization.initializationMethod == Initialization::IM_STEADY_STATE) {
-      Foundation::NumericalScheme tempNS = input.foundation.numericalScheme;
-      input.foundation.numericalScheme = Foundation::NS_STEADY_STATE;
-      updateBoundaryConditions(tInit);
-      ground.calculate(bcs);
-      printStatus(tInit);
-      input.foundation.numericalScheme = tempNS;
+    if (!stateCache) {
+      initializeTemperatures();
     } else {
-      std::size_t index;
-      for (size_t i = 0; i < ground.nX; ++i) {
-        for (size_t j = 0; j < ground.nY; ++j) {
-          for (size_t k = 0; k < ground.nZ; ++k) {
-            index = i + ground.nX * j + ground.nX * ground.nY * k;
-            ground.TOld[index] = getInitialTemperature(tInit, ground.domain.mesh[2].centers[k]);
-          }
-        }
+      const std::uint64_t key = stateKey(stateCache->version);
+      std::vector<double> T(ground.num_cells);
+      if (stateCache->load(key, T)) {
+        ground.setInitialTemperatures(T);
+        showMessage(MSG_INFO, "Initial temperatures loaded from the cache.");
+
+        // Surface conditions of the last initialization timestep
+        updateBoundaryConditions(input.simulationControl.startTime -
+                                 input.simulationControl.timestep);
+        ground.setBoundaryConditions(bcs);
+      } else {
+        initializeTemperatures();
+        stateCache->store(key, ground.TNew);
       }
     }
+  }
+  initPeriod = false;
+}
+
+void Simulator::initializeTemperatures() {
+  showMessage(MSG_INFO, "Initializing Temperatures...");
+
+  const boost::posix_time::ptime &startTime = input.simulationControl.startTime;
+  const long warmupDays = input.initialization.warmupDays;
+  if (input.initialization.coarseMeshFactor <= 1.0) {
+    calculateInitialConditions(ground, startTime, warmupDays);
+    return;
+  }
+
+  // Everything but the last (settling) days of the warmup is calculated on the coarse mesh. The
+  // coarse temperatures are then interpolated onto the simulation mesh, where the temperatures
+  // near the surfaces settle to the finer mesh.
+  const long settlingDays = std::min(input.initialization.fineMeshSettlingDays, warmupDays);
+  const boost::posix_time::ptime tSettle =
+      startTime - boost::posix_time::hours(settlingDays * 24);
+
+  Ground coarseGround(coarseFoundation, input.output.outputReport.outputMap);
+  coarseGround.buildDomain();
+  std::stringstream ss;
+  ss << "  Coarse Mesh Cells: " << coarseGround.num_cells;
+  showMessage(MSG_INFO, ss.str());
+
+  calculateInitialConditions(coarseGround, tSettle, warmupDays - settlingDays);
+  ground.interpolateTemperatures(coarseGround);
+
+  if (settlingDays > 0) {
+    warmUp(ground, tSettle, startTime);
+  } else {
+    // Surface conditions of the last initialization timestep
+    updateBoundaryConditions(startTime - input.simulationControl.timestep);
+    ground.setBoundaryConditions(bcs);
+  }
+}
+
+void Simulator::calculateInitialConditions(Ground &target, boost::posix_time::ptime tEnd,
+                                           long warmupDays) {
+  // Calculate initial time in seconds (end time minus warmup and acceleration periods)
+  boost::posix_time::time_duration &simulationTimestep = input.simulationControl.timestep;
+  boost::posix_time::time_duration accelTimestep =
+      boost::posix_time::hours(input.initialization.implicitAccelTimestep);
+
+  boost::posix_time::time_duration accelDuration =
+      accelTimestep * input.initialization.implicitAccelPeriods;
+  boost::posix_time::time_duration warmupDuration = boost::posix_time::hours(warmupDays * 24);
+
+  boost::posix_time::ptime tInit =
+      tEnd - warmupDuration - simulationTimestep - accelDuration - accelTimestep;
+
+  // Calculate initial conditions
+  if (input.initialization.initializationMethod == Initialization::IM_STEADY_STATE) {
+    Foundation::NumericalScheme tempNS = target.foundation.numericalScheme;
+    target.foundation.numericalScheme = Foundation::NS_STEADY_STATE;
+    updateBoundaryConditions(tInit);
+    target.calculate(bcs);
+    printStatus(tInit);
+    target.foundation.numericalScheme = tempNS;
+  } else {
+    // The periodic solution is found at the time of the first initialization timestep
+    const bool periodic =
+        input.initialization.initializationMethod == Initialization::IM_PERIODIC;
+    if (periodic && input.initialization.implicitAccelPeriods == 0) {
+      tInit = tEnd - warmupDuration - simulationTimestep;
+    }
 
-    // Calculate implicit acceleration
-    if (input.initialization.implicitAccelPeriods > 0) {
-      boost::posix_time::ptime tAccelStart = input.simulationControl.startTime - warmupDuration -
-                                             simulationTimestep -
-                                             accelDuration; // [s] Acceleration start time
-      boost::posix_time::ptime tAccelEnd = input.simulationControl.startTime - warmupDuration -
-                                           simulationTimestep; // [s] Acceleration end time
-
-      Foundation::NumericalScheme tempNS = input.foundation.numericalScheme;
-      input.foundation.numericalScheme = Foundation::NS_IMPLICIT;
-
-      for (boost::posix_time::ptime t = tAccelStart; t <= tAccelEnd; t += accelTimestep) {
-        updateBoundaryConditions(t);
-        ground.calculate(bcs, accelTimestep.total_seconds());
-        printStatus(t);
+    std::vector<double> T(target.num_cells);
+    std::size_t index;
+    for (size_t i = 0; i < target.nX; ++i) {
+      for (size_t j = 0; j < target.nY; ++j) {
+        for (size_t k = 0; k < target.nZ; ++k) {
+          index = i + target.nX * j + target.nX * target.nY * k;
+          T[index] = getInitialTemperature(tInit, target.domain.mesh[2].centers[k]);
+        }
       }
+    }
+    target.setInitialTemperatures(T);
+
+    if (periodic) {
+      // One year of boundary conditions repeats from tInit. The harmonics only need a few samples
+      // each. Samples are taken about a day apart, each about an hour later in the day than the
+      // last, so that the daily cycle averages out instead of aliasing onto the harmonics.
+      const double period = 365 * 24 * 3600.0;
+      const std::size_t numHarmonics = input.initialization.periodicHarmonics;
+      const std::size_t numSamples = std::max(
+          static_cast<std::size_t>(period / (25 * 3600.0)), 8 * (numHarmonics + 1));
+      Ground::BoundaryConditionsFunction boundaryConditionsAt =
+          [this, tInit](double offset) -> BoundaryConditions & {
+        updateBoundaryConditions(tInit + boost::posix_time::seconds(std::lround(offset)));
+        return bcs;
+      };
+      target.calculatePeriodic(boundaryConditionsAt, period, numSamples, numHarmonics);
+      printStatus(tInit);
+    }
+  }
+
+  // Calculate implicit acceleration
+  if (input.initialization.implicitAccelPeriods > 0) {
+    boost::posix_time::ptime tAccelStart = tEnd - warmupDuration - simulationTimestep -
+                                           accelDuration; // [s] Acceleration start time
+    boost::posix_time::ptime tAccelEnd =
+        tEnd - warmupDuration - simulationTimestep; // [s] Acceleration end time
 
-      input.foundation.numericalScheme = tempNS;
+    Foundation::NumericalScheme tempNS = target.foundation.numericalScheme;
+    target.foundation.numericalScheme = Foundation::NS_IMPLICIT;
+
+    for (boost::posix_time::ptime t = tAccelStart; t <= tAccelEnd; t += accelTimestep) {
+      updateBoundaryConditions(t);
+      target.calculate(bcs, accelTimestep.total_seconds());
+      printStatus(t);
     }
 
-    // Calculate warmup
-    if (input.initialization.warmupDays > 0) {
+    target.foundation.numericalScheme = tempNS;
+  }
 
-      boost::posix_time::ptime tWarmupStart =
-          input.simulationControl.startTime - warmupDuration; // [s] Acceleration start time
-      boost::posix_time::ptime tWarmupEnd =
-          input.simulationControl.startTime - simulationTimestep; // [s] Simulation end time
+  // Calculate warmup
+  if (warmupDays > 0) {
+    warmUp(target, tEnd - warmupDuration, tEnd);
+  }
+}
 
-      for (boost::posix_time::ptime t = tWarmupStart; t <= tWarmupEnd; t += simulationTimestep) {
-        updateBoundaryConditions(t);
-        ground.calculate(bcs, simulationTimestep.total_seconds());
-        printStatus(t);
-      }
+void Simulator::warmUp(Ground &target, boost::posix_time::ptime tStart,
+                       boost::posix_time::ptime tEnd) {
+  boost::posix_time::time_duration &simulationTimestep = input.simulationControl.timestep;
+  boost::posix_time::ptime tWarmupEnd = tEnd - simulationTimestep;
+
+  if (input.simulationControl.maximumTimestep > simulationTimestep) {
+    groundTime = tStart - simulationTimestep;
+    calculateAdaptive(target, tWarmupEnd, tWarmupEnd);
+  } else {
+    for (boost::posix_time::ptime t = tStart; t <= tWarmupEnd; t += simulationTimestep) {
+      updateBoundaryConditions(t);
+      target.calculate(bcs, simulationTimestep.total_seconds());
+      printStatus(t);
     }
   }
+}
+
+static void addToHash(StateHash &hash, const Material &material) {
+  hash.add(material.conductivity);
+  hash.add(material.density);
+  hash.add(material.specificHeat);
+}
+
+static void addToHash(StateHash &hash, const SurfaceProperties &properties) {
+  hash.add(properties.emissivity);
+  hash.add(properties.absorptivity);
+  hash.add(properties.roughness);
+}
+
+static void addToHash(StateHash &hash, const std::vector<Layer> &layers) {
+  hash.add(layers.size());
+  for (const auto &layer : layers) {
+    addToHash(hash, layer.material);
+    hash.add(layer.thickness);
+  }
+}
+
+static void addToHash(StateHash &hash, const Polygon &polygon) {
+  hash.add(polygon.outer().size());
+  for (const auto &point : polygon.outer()) {
+    hash.add(point.get<0>());
+    hash.add(point.get<1>());
+  }
+}
+
+static void addToHash(StateHash &hash, const Polygon3 &polygon) {
+  hash.add(polygon.outer().size());
+  for (const auto &point : polygon.outer()) {
+    hash.add(point.get<0>());
+    hash.add(point.get<1>());
+    hash.add(point.get<2>());
+  }
+}
+
+std::uint64_t Simulator::stateKey(const std::string &version) {
+  StateHash hash;
+  hash.add(version);
+  hash.add(StateCache::FORMAT_VERSION);
+
+  // Foundation inputs (after the adjustments made before building the domain). Values derived from
+  // them, and inputs that do not apply, are not part of the key.
+  const Foundation &fnd = input.foundation;
+  hash.add(fnd.deepGroundDepth);
+  hash.add(fnd.farFieldWidth);
+  hash.add(fnd.foundationDepth);
+  hash.add(fnd.orientation);
+  hash.add(fnd.deepGroundBoundary);
+  hash.add(fnd.wallTopBoundary);
+  if (fnd.wallTopBoundary == Foundation::WTB_LINEAR_DT) {
+    hash.add(fnd.wallTopInteriorTemperature);
+    hash.add(fnd.wallTopExteriorTemperature);
+  }
+  addToHash(hash, fnd.soil);
+  addToHash(hash, fnd.grade);
+  hash.add(fnd.coordinateSystem);
+  hash.add(fnd.numberOfDimensions);
+  hash.add(fnd.useSymmetry);
+  hash.add(fnd.reductionStrategy);
+  if (fnd.reductionStrategy == Foundation::RS_CUSTOM) {
+    hash.add(fnd.twoParameters);
+    if (fnd.twoParameters) {
+      hash.add(fnd.reductionLength1);
+    }
+    hash.add(fnd.reductionLength2);
+  }
+  addToHash(hash, fnd.polygon);
+  hash.add(fnd.isExposedPerimeter);
+  hash.add(fnd.exposedFraction);
+  hash.add(fnd.useDetailedExposedPerimeter);
+  hash.add(fnd.buildingHeight);
+  hash.add(fnd.buildingSurfaces.size());
+  for (const auto &surface : fnd.buildingSurfaces) {
+    addToHash(hash, surface);
+  }
+  hash.add(fnd.hasWall);
+  if (fnd.hasWall) {
+    addToHash(hash, fnd.wall.interior);
+    addToHash(hash, fnd.wall.exterior);
+    hash.add(fnd.wall.heightAboveGrade);
+    hash.add(fnd.wall.depthBelowSlab);
+    addToHash(hash, fnd.wall.layers);
+  }
+  hash.add(fnd.hasSlab);
+  if (fnd.hasSlab) {
+    addToHash(hash, fnd.slab.interior);
+    addToHash(hash, fnd.slab.layers);
+  }
+  hash.add(fnd.inputBlocks.size());
+  for (const auto &block : fnd.inputBlocks) {
+    hash.add(block.x);
+    hash.add(block.z);
+    hash.add(block.width);
+    hash.add(block.depth);
+    addToHash(hash, block.material);
+  }
+  hash.add(fnd.perimeterSurfaceWidth);
+  hash.add(fnd.hasPerimeterSurface);
+  hash.add(fnd.numericalScheme);
+  hash.add(fnd.fADI);
+  hash.add(fnd.tolerance);
+  hash.add(fnd.maxIterations);
+  hash.add(fnd.linearSolver);
+  hash.add(fnd.preconditionerRefreshInterval);
+  hash.add(fnd.preconditionerIterationGrowth);
+  hash.add(fnd.adaptiveTimestepTolerance);
+
+  // Mesh
+  hash.add(fnd.mesh.minCellDim);
+  hash.add(fnd.mesh.maxNearGrowthCoeff);
+  hash.add(fnd.mesh.maxDepthGrowthCoeff);
+  hash.add(fnd.mesh.maxInteriorGrowthCoeff);
+  hash.add(fnd.mesh.maxExteriorGrowthCoeff);
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    hash.add(ground.domain.mesh[dim].dividers);
+  }
+
+  // Boundaries (the convection algorithms are not used by the simulator)
+  const Boundaries &boundaries = input.boundaries;
+  hash.add(boundaries.indoorTemperatureMethod);
+  if (boundaries.indoorTemperatureMethod == Boundaries::ITM_FILE) {
+    hash.add(boundaries.indoorAirTemperatureFile.data);
+  } else {
+    hash.add(boundaries.indoorAirTemperature);
+  }
+  hash.add(boundaries.deltaLocal);
+  hash.add(boundaries.alphaLocal);
+  hash.add(boundaries.outdoorTemperatureMethod);
+  if (boundaries.outdoorTemperatureMethod == Boundaries::OTM_CONSTANT_TEMPERATURE) {
+    hash.add(boundaries.outdoorDryBulbTemperature);
+  }
+  hash.add(boundaries.deepGroundBoundaryType);
+  if (boundaries.deepGroundBoundaryType != Boundaries::DGBT_ZERO_FLUX) {
+    hash.add(boundaries.deepGroundTemperature);
+  }
+
+  // Initialization, which ends at the start of the simulation
+  const Initialization &initialization = input.initialization;
+  hash.add(initialization.initializationMethod);
+  if (initialization.initializationMethod == Initialization::IM_CONSTANT_TEMPERATURE) {
+    hash.add(initialization.initialTemperature);
+  }
+  hash.add(initialization.warmupDays);
+  hash.add(initialization.implicitAccelTimestep);
+  hash.add(initialization.implicitAccelPeriods);
+  hash.add(initialization.periodicHarmonics);
+  hash.add(initialization.coarseMeshFactor);
+  if (initialization.coarseMeshFactor > 1.0) {
+    hash.add(initialization.fineMeshSettlingDays);
+  }
+  hash.add(to_iso_string(input.simulationControl.startTime));
+  hash.add(input.simulationControl.timestep.total_seconds());
+  hash.add(input.simulationControl.maximumTimestep.total_seconds());
+
+  // Weather
+  hash.add(weatherData.latitude);
+  hash.add(weatherData.longitude);
+  hash.add(weatherData.timezone);
+  hash.add(weatherData.elevation);
+  for (const HourlyData *data :
+       {&weatherData.dryBulbTemp, &weatherData.dewPointTemp, &weatherData.atmosphericPressure,
+        &weatherData.relativeHumidity, &weatherData.directNormalSolar,
+        &weatherData.diffuseHorizontalSolar, &weatherData.windDirection, &weatherData.windSpeed,
+        &weatherData.totalSkyCover, &weatherData.opaqueSkyCover, &weatherData.skyEmissivity,
+        &weatherData.skyTemp, &weatherData.altitude, &weatherData.azimuth}) {
+    hash.add(*data);
+  }
+
+  return hash.value;
+}
+
+static const char CHECKPOINT_MAGIC[8] = {'K', 'I', 'V', 'A', 'C', 'K', 'P', 'T'};
+static const std::int64_t CHECKPOINT_FORMAT_VERSION = 2;
+static const std::int64_t NO_TIME = std::numeric_limits<std::int64_t>::min();
+
+// Milliseconds since 1970 (NO_TIME for special values)
+static std::int64_t toCheckpointTime(boost::posix_time::ptime t) {
+  if (t.is_special()) {
+    return NO_TIME;
+  }
+  return (t - boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1))).total_milliseconds();
+}
+
+static boost::posix_time::ptime fromCheckpointTime(std::int64_t milliseconds) {
+  if (milliseconds == NO_TIME) {
+    return boost::posix_time::ptime();
+  }
+  return boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1)) +
+         boost::posix_time::milliseconds(milliseconds);
+}
+
+std::uint64_t Simulator::checkpointKey() {
+  StateHash hash;
+  hash.add(stateKey(checkpoint.version));
+  hash.add(to_iso_string(input.simulationControl.endDate));
+  hash.add(input.output.outputReport.minFrequency.total_seconds());
+  hash.add(input.output.outputReport.size());
+  for (const auto &variable : input.output.outputReport) {
+    hash.add(variable.variableID);
+  }
+  hash.add(plots.size());
+  for (const auto &plot : plots) {
+    hash.add(plot.tStart);
+    hash.add(plot.tEnd);
+    hash.add(plot.snapshotSettings.frequency);
+    hash.add(plot.snapshotSettings.dir);
+  }
+  return hash.value;
+}
+
+void Simulator::writeCheckpoint(boost::posix_time::ptime t) {
+  outputFile.flush();
+
+  // Written to a temporary file first, so an interrupted write leaves the last checkpoint intact
+  const std::string tempFileName = checkpoint.fileName + ".tmp";
+  std::ofstream file(tempFileName.c_str(), std::ios::binary);
+  file.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+
+  StateWriter writer(file);
+  writer.writeInteger(CHECKPOINT_FORMAT_VERSION);
+  writer.writeInteger(static_cast<std::int64_t>(checkpointKey()));
+  writer.writeInteger(toCheckpointTime(t));
+  writer.writeInteger(toCheckpointTime(prevOutputTime));
+  writer.writeInteger(toCheckpointTime(groundTime));
+  writer.writeInteger(toCheckpointTime(previousGroundTime));
+  writer.write(previousOutputs.data(), previousOutputs.size());
+  writer.writeInteger(static_cast<std::int64_t>(outputFile.tellp()));
+  writer.writeInteger(static_cast<std::int64_t>(plots.size()));
+  for (const auto &plot : plots) {
+    writer.write(plot.nextPlotTime);
+    writer.writeInteger(plot.getFrameNumber());
+  }
+  ground.writeState(file);
+  file.close();
+
+  boost::system::error_code ec;
+  if (!writer.good()) {
+    ec = boost::system::errc::make_error_code(boost::system::errc::io_error);
+  } else {
+    boost::filesystem::rename(tempFileName, checkpoint.fileName, ec);
+  }
+  if (ec) {
+    showMessage(MSG_WARN, "Unable to write checkpoint \"" + checkpoint.fileName + "\".");
+  }
+}
+
+void Simulator::readCheckpoint() {
+  showMessage(MSG_INFO, "Resuming from checkpoint \"" + checkpoint.fileName + "\"...");
+
+  std::ifstream file(checkpoint.fileName.c_str(), std::ios::binary);
+  char magic[sizeof(CHECKPOINT_MAGIC)];
+  file.read(magic, sizeof(magic));
+  if (!file || !std::equal(magic, magic + sizeof(magic), CHECKPOINT_MAGIC)) {
+    showMessage(MSG_ERR, "\"" + checkpoint.fileName + "\" is not a checkpoint file.");
+  }
+
+  StateReader reader(file, "checkpoint \"" + checkpoint.fileName + "\"");
+  if (reader.readInteger() != CHECKPOINT_FORMAT_VERSION ||
+      static_cast<std::uint64_t>(reader.readInteger()) != checkpointKey()) {
+    showMessage(MSG_ERR, "Checkpoint \"" + checkpoint.fileName +
+                             "\" was written for different inputs, weather or program version.");
+  }
+  resumeTime = fromCheckpointTime(reader.readInteger());
+  prevOutputTime = fromCheckpointTime(reader.readInteger());
+  groundTime = fromCheckpointTime(reader.readInteger());
+  previousGroundTime = fromCheckpointTime(reader.readInteger());
+  reader.read(previousOutputs.data(), previousOutputs.size());
+  const std::int64_t outputLength = reader.readInteger();
+  if (reader.readInteger() != static_cast<std::int64_t>(plots.size())) {
+    showMessage(MSG_ERR, "Checkpoint \"" + checkpoint.fileName + "\" does not match the inputs.");
+  }
+  for (auto &plot : plots) {
+    plot.nextPlotTime = reader.read();
+    plot.setFrameNumber(static_cast<int>(reader.readInteger()));
+  }
+  ground.readState(file, bcs);
+
+  prevStatusUpdate = boost::posix_time::second_clock::local_time();
   initPeriod = false;
+
+  // Discard output written after the checkpoint
+  boost::system::error_code ec;
+  if (boost::filesystem::file_size(outputPath, ec) < static_cast<std::uintmax_t>(outputLength) ||
+      ec) {
+    showMessage(MSG_ERR, "Output file \"" + outputPath.string() +
+                             "\" is shorter than when the checkpoint was written.");
+  }
+  boost::filesystem::resize_file(outputPath, outputLength);
+  outputFile.open(outputPath.string().c_str(), std::ios::app);
 }
 
 void Simulator::initializePlots() {
@@ -235,29 +642,70 @@ void Simulator::simulate() {
   boost::posix_time::ptime simEnd(input.simulationControl.endDate + boost::gregorian::days(1));
   boost::posix_time::time_duration simDuration = simEnd - simStart;
 
-  prevOutputTime = input.simulationControl.startTime - input.output.outputReport.minFrequency;
   double timestep = input.simulationControl.timestep.total_seconds();
 
-  for (boost::posix_time::ptime t = simStart; t < simEnd;
+  bool adaptive = input.simulationControl.maximumTimestep > input.simulationControl.timestep;
+
+  // A resumed run continues with the output times and solution of its checkpoint
+  boost::posix_time::ptime tBegin = simStart;
+  if (resumeTime.is_not_a_date_time()) {
+    prevOutputTime = input.simulationControl.startTime - input.output.outputReport.minFrequency;
+    if (adaptive) {
+      // The initial solution is at the end of the initialization period
+      groundTime = simStart - input.simulationControl.timestep;
+      ground.calculateSurfaceAverages();
+    }
+  } else {
+    tBegin = resumeTime;
+  }
+  boost::posix_time::ptime nextCheckpoint = tBegin + checkpoint.interval;
+
+  for (boost::posix_time::ptime t = tBegin; t < simEnd;
        t = t + input.simulationControl.timestep) {
 
     percentComplete =
         round(double((t - simStart).total_seconds()) / double(simDuration.total_seconds()) * 1000) /
         10.0;
-    updateBoundaryConditions(t);
-    ground.calculate(bcs, timestep);
-    ground.calculateSurfaceAverages();
+    GroundOutput::OutputValues outputs;
+    if (adaptive) {
+      // Snapshots show the solution at groundTime (at or after t)
+      outputs = calculateAdaptive(ground, t, simEnd - input.simulationControl.timestep);
+    } else {
+      updateBoundaryConditions(t);
+      ground.calculate(bcs, timestep);
+      ground.calculateSurfaceAverages();
+      outputs = ground.groundOutput.outputValues;
+    }
     plot(t);
     printStatus(t);
 
     if (t - prevOutputTime >= input.output.outputReport.minFrequency) {
-      outputFile << to_simple_string(t) << printOutputLine() << std::endl;
+      outputFile << to_simple_string(t) << printOutputLine(outputs) << std::endl;
       prevOutputTime = t;
     }
+
+    boost::posix_time::ptime tNext = t + input.simulationControl.timestep;
+    if (!checkpoint.fileName.empty() && tNext >= nextCheckpoint && tNext < simEnd) {
+      writeCheckpoint(tNext);
+      nextCheckpoint = tNext + checkpoint.interval;
+    }
+  }
+
+  if (!checkpoint.fileName.empty()) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(checkpoint.fileName, ec);
   }
 
   showMessage(MSG_INFO,
               "  " + to_simple_string(simEnd - input.simulationControl.timestep) + " (100%)");
+
+  if (reportMemory) {
+    printMemoryReport("Simulation");
+  }
+}
+
+void Simulator::printMemoryReport(const std::string &stage) {
+  showMessage(MSG_INFO, "Memory Usage (" + stage + "):\n" + ground.memoryReport().toString());
 }
 
 void Simulator::plot(boost::posix_time::ptime t) {
@@ -363,7 +811,9 @@ void Simulator::printStatus(boost::posix_time::ptime t) {
 }
 
 double Simulator::getInitialTemperature(boost::posix_time::ptime t, double z) {
-  if (input.initialization.initializationMethod == Initialization::IM_KUSUDA) {
+  // The Kusuda profile also provides the surface temperatures for the periodic initialization
+  if (input.initialization.initializationMethod == Initialization::IM_KUSUDA ||
+      input.initialization.initializationMethod == Initialization::IM_PERIODIC) {
     boost::gregorian::greg_year year = t.date().year();
     boost::gregorian::date dayBegin(year, boost::gregorian::Jan, 1);
     boost::posix_time::ptime tYearStart(dayBegin);
@@ -430,7 +880,37 @@ std::string Simulator::printOutputHeaders() {
   return outputHeader;
 }
 
-std::string Simulator::printOutputLine() {
+GroundOutput::OutputValues Simulator::calculateAdaptive(Ground &target, boost::posix_time::ptime t,
+                                                        boost::posix_time::ptime tLast) {
+  const double timestep = input.simulationControl.timestep.total_seconds();
+  const double maximumTimestep = input.simulationControl.maximumTimestep.total_seconds();
+
+  Ground::BoundaryConditionsFunction boundaryConditionsAt =
+      [this](double offset) -> BoundaryConditions & {
+    updateBoundaryConditions(groundTime +
+                             boost::posix_time::milliseconds(std::llround(offset * 1000)));
+    return bcs;
+  };
+
+  while (groundTime < t) {
+    previousGroundTime = groundTime;
+    previousOutputs = target.groundOutput.outputValues;
+
+    // Steps do not go past the last output time
+    double remaining = (tLast - groundTime).total_milliseconds() / 1000.0;
+    double step = target.calculateAdaptive(boundaryConditionsAt, std::min(timestep, remaining),
+                                           std::min(maximumTimestep, remaining));
+    groundTime += boost::posix_time::milliseconds(std::llround(step * 1000));
+    printStatus(groundTime);
+  }
+
+  double fraction = double((t - previousGroundTime).total_milliseconds()) /
+                    double((groundTime - previousGroundTime).total_milliseconds());
+  return GroundOutput::OutputValues::interpolate(previousOutputs, target.groundOutput.outputValues,
+                                                 fraction);
+}
+
+std::string Simulator::printOutputLine(const GroundOutput::OutputValues &outputs) {
   std::string outputLine = "";
 
   for (auto out : input.output.outputReport) {
@@ -440,8 +920,8 @@ std::string Simulator::printOutputLine() {
     double totalArea = 0.0;
     for (auto surface : out.surfaces) {
       if (ground.foundation.hasSurface[surface]) {
-        totalValue += ground.getSurfaceAverageValue({surface, out.outType});
-        totalVA += ground.getSurfaceAverageValue({surface, out.outType}) *
+        totalValue += outputs(surface, out.outType);
+        totalVA += outputs(surface, out.outType) *
                    ground.foundation.surfaceAreas[surface];
         totalArea += ground.foundation.surfaceAreas[surface];
       }
@@ -21,14 +21,29 @@
 #include "GroundOutput.hpp"
 #include "GroundPlot.hpp"
 #include "Input.hpp"
+#include "StateCache.hpp"
 #include "WeatherData.hpp"
 
 using namespace Kiva;
 
+// Periodic checkpoints of the simulation state. A run with a checkpoint file that already exists
+// resumes from it (continuing the output file from the checkpoint), and the file is removed when
+// the simulation finishes.
+class CheckpointSettings {
+public:
+  CheckpointSettings() : interval(boost::posix_time::hours(30 * 24)) {}
+
+  std::string fileName;                       // no checkpoints if empty
+  boost::posix_time::time_duration interval;  // of simulated time between checkpoints
+  std::string version; // of the program (checkpoints are only resumed by the same version)
+};
+
 class Simulator {
 public:
   // Constructor
-  Simulator(WeatherData &weatherData, Input &input, std::string outputFileName);
+  Simulator(WeatherData &weatherData, Input &input, std::string outputFileName,
+            bool reportMemory = false, StateCache *stateCache = nullptr,
+            const CheckpointSettings &checkpoint = CheckpointSettings());
 
   virtual ~Simulator();
   void simulate();
@@ -40,20 +55,50 @@ public:
 
   double percentComplete;
 
+  bool reportMemory; // print the memory held by the ground after building and simulating
+
+  StateCache *stateCache; // initial temperatures saved between runs (not used if null)
+
+  CheckpointSettings checkpoint;
+
 private:
   Ground ground;
   BoundaryConditions bcs;
 
   std::vector<GroundPlot> plots;
   std::ofstream outputFile;
+  boost::filesystem::path outputPath;
   boost::filesystem::path outputDir;
   void initializePlots();
   void initializeConditions();
+  void initializeTemperatures();
+
+  // Initialization of a ground (the simulation's or a coarser one) ending at tEnd
+  void calculateInitialConditions(Ground &target, boost::posix_time::ptime tEnd, long warmupDays);
+  void warmUp(Ground &target, boost::posix_time::ptime tStart, boost::posix_time::ptime tEnd);
+
+  // Copy of the foundation (before its domain is built) with a coarser mesh, for initializations
+  // with a coarse mesh factor
+  Foundation coarseFoundation;
+
+  // Key of the initial temperatures in the state cache: a hash of the program version, foundation,
+  // mesh, boundary conditions, initialization and weather (everything the initialization depends
+  // on)
+  std::uint64_t stateKey(const std::string &version);
+
+  // Checkpoints hold the time of the next timestep, the output times, the length of the output
+  // file and the plot frames, followed by the ground state. They are keyed by the state key and
+  // the simulation period and outputs.
+  std::uint64_t checkpointKey();
+  void writeCheckpoint(boost::posix_time::ptime t);
+  void readCheckpoint();
+  boost::posix_time::ptime resumeTime; // time of the next timestep of a resumed run
 
   void printStatus(boost::posix_time::ptime t);
+  void printMemoryReport(const std::string &stage);
 
   std::string printOutputHeaders();
-  std::string printOutputLine();
+  std::string printOutputLine(const GroundOutput::OutputValues &outputs);
 
   void plot(boost::posix_time::ptime t);
 
@@ -64,6 +109,14 @@ private:
   double getInitialTemperature(boost::posix_time::ptime t, double z);
 
   void updateBoundaryConditions(boost::posix_time::ptime t);
+
+  // Adaptive timesteps (if the maximum timestep is longer than the timestep). The ground solution
+  // is advanced past each output time, and the surface averages are interpolated to it.
+  GroundOutput::OutputValues calculateAdaptive(Ground &target, boost::posix_time::ptime t,
+                                               boost::posix_time::ptime tLast);
+  boost::posix_time::ptime groundTime; // time of the ground solution
+  boost::posix_time::ptime previousGroundTime;
+  GroundOutput::OutputValues previousOutputs; // surface averages at previousGroundTime
 };
 
 #endif // Simulator_HPP
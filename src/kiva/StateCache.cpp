@@ -0,0 +1,149 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StateCache_CPP
+#define StateCache_CPP
+
+#include "StateCache.hpp"
+#include "Errors.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+using namespace Kiva;
+
+static const char STATE_MAGIC[8] = {'K', 'I', 'V', 'A', 'S', 'T', 'A', 'T'};
+
+const std::uint32_t StateCache::FORMAT_VERSION = 1;
+
+StateHash::StateHash() : value(14695981039346656037ULL) {}
+
+void StateHash::add(const void *data, std::size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < size; i++) {
+    value ^= bytes[i];
+    value *= 1099511628211ULL;
+  }
+}
+
+void StateHash::add(double value) {
+  if (value == 0.0) {
+    value = 0.0; // -0.0 and 0.0 are the same input
+  }
+  add(&value, sizeof(value));
+}
+
+void StateHash::add(const std::string &value) {
+  add(value.size());
+  add(value.data(), value.size());
+}
+
+StateCache::StateCache(const std::string &directory, std::size_t maxEntries,
+                       const std::string &version)
+    : version(version), directory(directory), maxEntries(maxEntries) {
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(this->directory, ec);
+  if (ec) {
+    showMessage(MSG_ERR, "Unable to create cache directory \"" + directory + "\": " + ec.message());
+  }
+}
+
+boost::filesystem::path StateCache::statePath(std::uint64_t key) const {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << key << ".state";
+  return directory / ss.str();
+}
+
+bool StateCache::load(std::uint64_t key, std::vector<double> &T) {
+  const boost::filesystem::path path = statePath(key);
+  std::ifstream file(path.string().c_str(), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  char magic[sizeof(STATE_MAGIC)];
+  std::uint32_t version;
+  std::uint64_t fileKey, numCells;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char *>(&version), sizeof(version));
+  file.read(reinterpret_cast<char *>(&fileKey), sizeof(fileKey));
+  file.read(reinterpret_cast<char *>(&numCells), sizeof(numCells));
+  if (!file || !std::equal(magic, magic + sizeof(magic), STATE_MAGIC) ||
+      version != FORMAT_VERSION || fileKey != key || numCells != T.size()) {
+    return false;
+  }
+
+  std::vector<double> values(T.size());
+  file.read(reinterpret_cast<char *>(values.data()), values.size() * sizeof(double));
+  if (!file) {
+    return false;
+  }
+  std::copy(values.begin(), values.end(), T.begin());
+
+  // Mark the state as recently used
+  boost::system::error_code ec;
+  boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+  return true;
+}
+
+void StateCache::store(std::uint64_t key, const std::vector<double> &T) {
+  // Written to a temporary file first, so concurrent runs never read a partial state
+  const boost::filesystem::path path = statePath(key);
+  const boost::filesystem::path tempPath =
+      directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  {
+    std::ofstream file(tempPath.string().c_str(), std::ios::binary);
+    const std::uint32_t version = FORMAT_VERSION;
+    const std::uint64_t numCells = T.size();
+    file.write(STATE_MAGIC, sizeof(STATE_MAGIC));
+    file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char *>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char *>(&numCells), sizeof(numCells));
+    file.write(reinterpret_cast<const char *>(T.data()), T.size() * sizeof(double));
+    if (!file) {
+      file.close();
+      boost::system::error_code ec;
+      boost::filesystem::remove(tempPath, ec);
+      showMessage(MSG_WARN, "Unable to write initial temperatures to the cache.");
+      return;
+    }
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tempPath, path, ec);
+  if (ec) {
+    boost::filesystem::remove(tempPath, ec);
+    showMessage(MSG_WARN, "Unable to write initial temperatures to the cache.");
+    return;
+  }
+
+  evict(path);
+}
+
+void StateCache::evict(const boost::filesystem::path &keep) {
+  std::vector<std::pair<std::time_t, boost::filesystem::path>> states;
+  boost::system::error_code ec;
+  for (boost::filesystem::directory_iterator it(directory, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    if (it->path().extension() == ".state" && it->path() != keep) {
+      boost::system::error_code timeEc;
+      std::time_t lastUsed = boost::filesystem::last_write_time(it->path(), timeEc);
+      if (!timeEc) {
+        states.emplace_back(lastUsed, it->path());
+      }
+    }
+  }
+  // The state just written is always kept, along with the most recently used of the others
+  const std::size_t numKept = maxEntries > 0 ? maxEntries - 1 : 0;
+  if (states.size() <= numKept) {
+    return;
+  }
+  std::sort(states.begin(), states.end());
+  for (std::size_t i = 0; i < states.size() - numKept; i++) {
+    boost::filesystem::remove(states[i].second, ec);
+  }
+}
+
+#endif
@@ -0,0 +1,68 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StateCache_HPP
+#define StateCache_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+// 64-bit FNV-1a hash of the values that determine a warmed-up ground state
+class StateHash {
+public:
+  StateHash();
+
+  void add(const void *data, std::size_t size);
+  void add(double value);
+  void add(const std::string &value);
+
+  // Integers, booleans and enumerations
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+  add(T value) {
+    const std::int64_t v = static_cast<std::int64_t>(value);
+    add(&v, sizeof(v));
+  }
+
+  template <typename T> void add(const std::vector<T> &values) {
+    add(values.size());
+    for (const auto &value : values) {
+      add(value);
+    }
+  }
+
+  std::uint64_t value;
+};
+
+// Ground temperatures at the end of the initialization, saved between runs. Each state is a file
+// in the cache directory named by its key (the hash of its inputs and weather). The files hold a
+// header with a format version, the key and the number of cells, followed by the temperatures in
+// the native binary representation. States that cannot be read, or were written by another
+// format version, are treated as missing. Beyond maxEntries states, the least recently used
+// (written or read) are removed.
+class StateCache {
+public:
+  StateCache(const std::string &directory, std::size_t maxEntries, const std::string &version);
+
+  // Reads the state into T (which must already have the number of cells of the state)
+  bool load(std::uint64_t key, std::vector<double> &T);
+  void store(std::uint64_t key, const std::vector<double> &T);
+
+  std::string version; // of the program, part of every key (states change with the solution)
+
+  static const std::uint32_t FORMAT_VERSION;
+
+private:
+  boost::filesystem::path directory;
+  std::size_t maxEntries;
+
+  boost::filesystem::path statePath(std::uint64_t key) const;
+  void evict(const boost::filesystem::path &keep);
+};
+
+#endif // StateCache_HPP
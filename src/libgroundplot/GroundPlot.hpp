@@ -93,6 +93,9 @@ public:
   double tStart, tEnd;
   double nextPlotTime;
   GroundPlot(SnapshotSettings &snapshotSettings, Domain &domain, Foundation &foundation);
+  // Number of the next frame (restored when resuming from a checkpoint)
+  int getFrameNumber() const { return frameNumber; }
+  void setFrameNumber(int number) { frameNumber = number; }
   void createFrame(std::string timeStamp = "");
   bool makeNewFrame(double t);
 };
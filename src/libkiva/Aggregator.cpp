@@ -66,11 +66,11 @@ void Aggregator::calc_weighted_results() {
     Tr = surface_type == Surface::ST_WALL_INT ? grnd->bcs.wallRadiantTemp
                                               : grnd->bcs.slabRadiantTemp;
     double p = instance.second;
-    double hci = grnd->getSurfaceAverageValue({surface_type, Kiva::GroundOutput::OT_CONV});
-    double hri = grnd->getSurfaceAverageValue({surface_type, Kiva::GroundOutput::OT_RAD});
-    double Ts = grnd->getSurfaceAverageValue({surface_type, Kiva::GroundOutput::OT_TEMP});
-    double Ta = grnd->getSurfaceAverageValue({surface_type, Kiva::GroundOutput::OT_AVG_TEMP});
-    double qi = -grnd->getSurfaceAverageValue({surface_type, Kiva::GroundOutput::OT_FLUX});
+    double hci = grnd->getSurfaceAverageValue(surface_type, Kiva::GroundOutput::OT_CONV);
+    double hri = grnd->getSurfaceAverageValue(surface_type, Kiva::GroundOutput::OT_RAD);
+    double Ts = grnd->getSurfaceAverageValue(surface_type, Kiva::GroundOutput::OT_TEMP);
+    double Ta = grnd->getSurfaceAverageValue(surface_type, Kiva::GroundOutput::OT_AVG_TEMP);
+    double qi = -grnd->getSurfaceAverageValue(surface_type, Kiva::GroundOutput::OT_FLUX);
 
     if (!std::isfinite(Ts)) {
       showMessage(MSG_ERR, "Kiva is not giving realistic results!");
@@ -94,4 +94,12 @@ std::pair<Ground *, double> Aggregator::get_instance(std::size_t index) {
   return instances[index];
 }
 
+MemoryReport Aggregator::memoryReport() const {
+  MemoryReport report;
+  for (auto &instance : instances) {
+    report.add(instance.first->memoryReport());
+  }
+  return report;
+}
+
 } // namespace Kiva
@@ -17,6 +17,8 @@ public:
   std::size_t size();
   void calc_weighted_results();
   std::pair<Ground *, double> get_instance(std::size_t index);
+  // Sum of the reports of the instances' grounds
+  MemoryReport memoryReport() const;
 
 
   struct Results {
@@ -0,0 +1,167 @@
+// Derived from Eigen's BiCGSTAB.h (Eigen is a lightweight C++ template library for linear
+// algebra), and distributed under the same license:
+//
+// Copyright (C) 2011-2014 Gael Guennebaud <gael.guennebaud@inria.fr>
+// Copyright (C) 2012 Désiré Nuentsa-Wakam <desire.nuentsa_wakam@inria.fr>
+// Modifications copyright (c) 2019 Big Ladder Software LLC
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BiCGSTAB_HPP
+#define BiCGSTAB_HPP
+
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+#include <Eigen/Core>
+
+namespace Kiva {
+
+// Preconditioned bi-conjugate gradient stabilized solver. This is the algorithm of
+// Eigen::BiCGSTAB, except that its work vectors are kept between solutions, so solving a system of
+// unchanged size does not allocate. The preconditioner must provide
+//   void apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const;
+// which writes its approximate solution of A*x = b to x (already sized) without allocating.
+// Like Eigen's solvers, it keeps a reference to the matrix passed to analyzePattern and factorize.
+template <typename MatrixType, typename PreconditionerType> class BiCGSTAB {
+public:
+  typedef PreconditionerType Preconditioner;
+
+  BiCGSTAB()
+      : matrix(nullptr), maxIters(-1), tolerance(std::numeric_limits<double>::epsilon()),
+        iters(0), err(0.0), status(Eigen::Success) {}
+
+  void setMaxIterations(int maxIterations) { maxIters = maxIterations; }
+  void setTolerance(double tol) { tolerance = tol; }
+
+  BiCGSTAB &analyzePattern(const MatrixType &A) {
+    matrix = &A;
+    precond.analyzePattern(A);
+    return *this;
+  }
+
+  BiCGSTAB &factorize(const MatrixType &A) {
+    matrix = &A;
+    precond.factorize(A);
+    return *this;
+  }
+
+  BiCGSTAB &compute(const MatrixType &A) {
+    matrix = &A;
+    precond.compute(A);
+    return *this;
+  }
+
+  // Solves A*x = b starting from x0. x may be the same storage as x0.
+  void solveWithGuess(const Eigen::VectorXd &b, const Eigen::Ref<const Eigen::VectorXd> &x0,
+                      Eigen::Ref<Eigen::VectorXd> x);
+
+  Eigen::ComputationInfo info() const { return status; }
+  int iterations() const { return iters; }
+  double error() const { return err; }
+
+  Preconditioner &preconditioner() { return precond; }
+  const Preconditioner &preconditioner() const { return precond; }
+
+private:
+  const MatrixType *matrix;
+  Preconditioner precond;
+  int maxIters;
+  double tolerance;
+  int iters;
+  double err;
+  Eigen::ComputationInfo status;
+
+  Eigen::VectorXd r, r0, v, p, y, z, s, t; // work vectors
+};
+
+template <typename MatrixType, typename PreconditionerType>
+void BiCGSTAB<MatrixType, PreconditionerType>::solveWithGuess(
+    const Eigen::VectorXd &b, const Eigen::Ref<const Eigen::VectorXd> &x0,
+    Eigen::Ref<Eigen::VectorXd> x) {
+  if (x.data() != x0.data()) {
+    x = x0;
+  }
+
+  const MatrixType &A = *matrix;
+  const Eigen::Index n = A.cols();
+  const Eigen::Index maxIterations = maxIters < 0 ? 2 * n : maxIters;
+  for (Eigen::VectorXd *work : {&r, &r0, &v, &p, &y, &z, &s, &t}) {
+    work->resize(n); // only allocates when the size changes
+  }
+
+  r = b;
+  r.noalias() -= A * x;
+  r0 = r;
+
+  double r0_sqnorm = r0.squaredNorm();
+  const double rhs_sqnorm = b.squaredNorm();
+  if (rhs_sqnorm == 0) {
+    x.setZero();
+    iters = 0;
+    err = 0.0;
+    status = Eigen::Success;
+    return;
+  }
+  double rho = 1;
+  double alpha = 1;
+  double w = 1;
+
+  v.setZero();
+  p.setZero();
+
+  const double tol2 = tolerance * tolerance * rhs_sqnorm;
+  const double eps2 =
+      std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon();
+  Eigen::Index i = 0;
+  Eigen::Index restarts = 0;
+
+  while (r.squaredNorm() > tol2 && i < maxIterations) {
+    double rho_old = rho;
+
+    rho = r0.dot(r);
+    if (std::abs(rho) < eps2 * r0_sqnorm) {
+      // The new residual vector became too orthogonal to the arbitrarily chosen direction r0.
+      // Restart with a new r0.
+      r = b;
+      r.noalias() -= A * x;
+      r0 = r;
+      rho = r0_sqnorm = r.squaredNorm();
+      if (restarts++ == 0) {
+        i = 0;
+      }
+    }
+    double beta = (rho / rho_old) * (alpha / w);
+    p = r + beta * (p - w * v);
+
+    precond.apply(p, y);
+
+    v.noalias() = A * y;
+
+    alpha = rho / r0.dot(v);
+    s = r - alpha * v;
+
+    precond.apply(s, z);
+    t.noalias() = A * z;
+
+    double tmp = t.squaredNorm();
+    if (tmp > 0.0) {
+      w = t.dot(s) / tmp;
+    } else {
+      w = 0.0;
+    }
+    x += alpha * y + w * z;
+    r = s - w * t;
+    ++i;
+  }
+  err = std::sqrt(r.squaredNorm() / rhs_sqnorm);
+  iters = static_cast<int>(i);
+  status = err <= tolerance ? Eigen::Success : Eigen::NoConvergence;
+}
+
+} // namespace Kiva
+
+#endif
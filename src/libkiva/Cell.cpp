@@ -5,49 +5,84 @@
 #define Cell_CPP
 
 #include "Cell.hpp"
+#include "MemoryReport.hpp"
 
 namespace Kiva {
 
 static const double PI = 4.0 * atan(1.0);
 
-Cell::Cell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-           const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-           const Foundation &foundation, Surface *surfacePtr, Block *blockPtr, Mesher *meshPtr)
-    : coords{i, j, k}, index(index), stepsize(stepsize), cellType(cellType), blockPtr(blockPtr),
-      surfacePtr(surfacePtr), meshPtr(meshPtr) {
-  Assemble(foundation);
+void CellStore::resize(std::size_t num_cells) {
+  cellType.resize(num_cells);
+  surfacePtr.assign(num_cells, nullptr);
+  blockPtr.assign(num_cells, nullptr);
+  density.resize(num_cells);
+  specificHeat.resize(num_cells);
+  conductivity.resize(num_cells);
+  iHeatCapacity.resize(num_cells);
+  volume.resize(num_cells);
+  area.assign(num_cells, 0.0);
+  heatGain.assign(num_cells, 0.0);
+  for (std::size_t dim = 0; dim < 3; ++dim) {
+    for (std::size_t dir = 0; dir < 2; ++dir) {
+      pde[dim][dir].assign(num_cells, 0.0);
+      kcoeff[dim][dir].assign(num_cells, 0.0);
+    }
+  }
+  pde_c[0].assign(num_cells, 0.0);
+  pde_c[1].assign(num_cells, 0.0);
 }
 
-void Cell::Assemble(const Foundation &foundation) {
-  if (blockPtr) {
-    density = blockPtr->material.density;
-    specificHeat = blockPtr->material.specificHeat;
-    conductivity = blockPtr->material.conductivity;
+std::size_t CellStore::memoryUsage() const {
+  std::size_t bytes = Kiva::memoryUsage(cellType) + Kiva::memoryUsage(surfacePtr) +
+                      Kiva::memoryUsage(blockPtr) + Kiva::memoryUsage(density) +
+                      Kiva::memoryUsage(specificHeat) + Kiva::memoryUsage(conductivity) +
+                      Kiva::memoryUsage(iHeatCapacity) + Kiva::memoryUsage(volume) +
+                      Kiva::memoryUsage(area) + Kiva::memoryUsage(heatGain) +
+                      Kiva::memoryUsage(pde_c[0]) + Kiva::memoryUsage(pde_c[1]);
+  for (std::size_t dim = 0; dim < 3; ++dim) {
+    for (std::size_t dir = 0; dir < 2; ++dir) {
+      bytes += Kiva::memoryUsage(pde[dim][dir]) + Kiva::memoryUsage(kcoeff[dim][dir]) +
+               Kiva::memoryUsage(dist[dim][dir]);
+    }
+  }
+  return bytes;
+}
+
+void CellStore::gatherCCoeffs(std::size_t index, double theta, bool cylindrical,
+                              double (&C)[3][2]) const {
+  if (cylindrical) {
+    gatherCCoeffs<0, true>(index, theta, C);
   } else {
-    density = foundation.soil.density;
-    specificHeat = foundation.soil.specificHeat;
-    conductivity = foundation.soil.conductivity;
+    gatherCCoeffs<0, false>(index, theta, C);
   }
-  heatGain = 0.0;
-  volume =
-      meshPtr[0].deltas[coords[0]] * meshPtr[1].deltas[coords[1]] * meshPtr[2].deltas[coords[2]];
+}
 
-  iHeatCapacity = 1 / (density * specificHeat);
-  iHeatCapacityADI = iHeatCapacity / foundation.numberOfDimensions; // because of each sub-timestep
+Cell::Cell(const std::size_t &index, const CellType cellType, const std::size_t &i,
+           const std::size_t &j, const std::size_t &k, const std::shared_ptr<CellStore> &store,
+           const Foundation &foundation, Surface *surfacePtr, Block *blockPtr)
+    : coords{static_cast<CellIndex>(i), static_cast<CellIndex>(j), static_cast<CellIndex>(k)},
+      index(static_cast<CellIndex>(index)), store(store) {
+  store->cellType[index] = cellType;
+  store->surfacePtr[index] = surfacePtr;
+  store->blockPtr[index] = blockPtr;
+  Assemble(foundation);
+}
 
-  if (foundation.numberOfDimensions == 2) {
-    r = meshPtr[0].centers[coords[0]];
+void Cell::Assemble(const Foundation &foundation) {
+  if (blockPtr()) {
+    density() = blockPtr()->material.density;
+    specificHeat() = blockPtr()->material.specificHeat;
+    conductivity() = blockPtr()->material.conductivity;
+  } else {
+    density() = foundation.soil.density;
+    specificHeat() = foundation.soil.specificHeat;
+    conductivity() = foundation.soil.conductivity;
   }
-}
+  heatGain() = 0.0;
+  Mesher *mesh = meshPtr();
+  volume() = mesh[0].deltas[coords[0]] * mesh[1].deltas[coords[1]] * mesh[2].deltas[coords[2]];
 
-void Cell::setDistances(const double &dxp_in, const double &dxm_in, const double &dyp_in,
-                        const double &dym_in, const double &dzp_in, const double &dzm_in) {
-  dist[0][1] = dxp_in;
-  dist[0][0] = dxm_in;
-  dist[1][1] = dyp_in;
-  dist[1][0] = dym_in;
-  dist[2][1] = dzp_in;
-  dist[2][0] = dzm_in;
+  iHeatCapacity() = 1 / (density() * specificHeat());
 }
 
 void Cell::setConductivities(const std::vector<std::shared_ptr<Cell>> &cell_v) {
@@ -56,52 +91,50 @@ void Cell::setConductivities(const std::vector<std::shared_ptr<Cell>> &cell_v) {
     if (coords[dim] == 0) {
       // For boundary cells assume that the cell on the other side of the
       // boundary is the same as the current cell
-      kcoeff[dim][0] = conductivity;
+      kcoeff(dim, 0) = conductivity();
     } else {
-      kcoeff[dim][0] = 1 / (meshPtr[dim].deltas[coords[dim]] / (2 * dist[dim][0] * conductivity) +
-                            meshPtr[dim].deltas[coords[dim] - 1] /
-                                (2 * dist[dim][0] * cell_v[index - stepsize[dim]]->conductivity));
+      const Mesher &m = meshPtr()[dim];
+      kcoeff(dim, 0) =
+          1 / (m.deltas[coords[dim]] / (2 * dist(dim, 0) * conductivity()) +
+               m.deltas[coords[dim] - 1] /
+                   (2 * dist(dim, 0) * cell_v[index - stepsize()[dim]]->conductivity()));
     }
 
     //  dir == 1
-    if (coords[dim] == meshPtr[dim].centers.size() - 1) {
-      kcoeff[dim][1] = conductivity;
+    if (coords[dim] == meshPtr()[dim].centers.size() - 1) {
+      kcoeff(dim, 1) = conductivity();
     } else {
-      kcoeff[dim][1] = 1 / (meshPtr[dim].deltas[coords[dim]] / (2 * dist[dim][1] * conductivity) +
-                            meshPtr[dim].deltas[coords[dim] + 1] /
-                                (2 * dist[dim][1] * cell_v[index + stepsize[dim]]->conductivity));
+      const Mesher &m = meshPtr()[dim];
+      kcoeff(dim, 1) =
+          1 / (m.deltas[coords[dim]] / (2 * dist(dim, 1) * conductivity()) +
+               m.deltas[coords[dim] + 1] /
+                   (2 * dist(dim, 1) * cell_v[index + stepsize()[dim]]->conductivity()));
     }
   }
 }
 
 void Cell::setPDEcoefficients(int ndims, bool cylindrical) {
 
-  for (auto dim : dims) {
+  for (auto dim : dims()) {
     if (dim < 5) {
-      pde[dim][1] = onePDEcoefficient(dim, 1);
-      pde[dim][0] = onePDEcoefficient(dim, 0);
+      pde(dim, 1) = onePDEcoefficient(dim, 1);
+      pde(dim, 0) = onePDEcoefficient(dim, 0);
     }
   }
 
   // Radial X terms
   if (ndims == 2 && cylindrical) {
-    pde_c[1] = (dist[0][0] * kcoeff[0][1]) / ((dist[0][0] + dist[0][1]) * dist[0][1]);
-    pde_c[0] = (dist[0][1] * kcoeff[0][0]) / ((dist[0][0] + dist[0][1]) * dist[0][0]);
+    pde_c(1) = (dist(0, 0) * kcoeff(0, 1)) / ((dist(0, 0) + dist(0, 1)) * dist(0, 1));
+    pde_c(0) = (dist(0, 1) * kcoeff(0, 0)) / ((dist(0, 0) + dist(0, 1)) * dist(0, 0));
   }
 }
 
 double Cell::onePDEcoefficient(std::size_t dim, std::size_t dir) {
   int sign = dir == 0 ? -1 : 1;
-  double c = sign * (2 * kcoeff[dim][dir]) / ((dist[dim][0] + dist[dim][1]) * dist[dim][dir]);
+  double c = sign * (2 * kcoeff(dim, dir)) / ((dist(dim, 0) + dist(dim, 1)) * dist(dim, dir));
   return c;
 }
 
-void Cell::setComputeDims(std::size_t (&in_dims)[3]) {
-  for (std::size_t d = 0; d < 3; ++d) {
-    dims[d] = in_dims[d];
-  }
-}
-
 void Cell::setZeroThicknessCellProperties(std::vector<std::shared_ptr<Cell>> pointSet) {
   std::vector<double> volumes;
   std::vector<double> densities;
@@ -114,11 +147,12 @@ void Cell::setZeroThicknessCellProperties(std::vector<std::shared_ptr<Cell>> poi
 
   for (auto p_cell : pointSet) {
     // Do not add air cell properties into the weighted average
-    if (p_cell->cellType != CellType::INTERIOR_AIR && p_cell->cellType != CellType::EXTERIOR_AIR) {
-      double vol = p_cell->volume;
-      double rho = p_cell->density;
-      double cp = p_cell->specificHeat;
-      double kth = p_cell->conductivity;
+    if (p_cell->cellType() != CellType::INTERIOR_AIR &&
+        p_cell->cellType() != CellType::EXTERIOR_AIR) {
+      double vol = p_cell->volume();
+      double rho = p_cell->density();
+      double cp = p_cell->specificHeat();
+      double kth = p_cell->conductivity();
 
       volumes.push_back(vol);
       masses.push_back(vol * rho);
@@ -137,70 +171,37 @@ void Cell::setZeroThicknessCellProperties(std::vector<std::shared_ptr<Cell>> poi
 
   double totalVolume = std::accumulate(volumes.begin(), volumes.end(), 0.0);
 
-  density = std::accumulate(masses.begin(), masses.end(), 0.0) / totalVolume;
+  density() = std::accumulate(masses.begin(), masses.end(), 0.0) / totalVolume;
 
-  specificHeat =
-      std::accumulate(capacities.begin(), capacities.end(), 0.0) / (totalVolume * density);
+  specificHeat() =
+      std::accumulate(capacities.begin(), capacities.end(), 0.0) / (totalVolume * density());
 
-  conductivity =
+  conductivity() =
       std::accumulate(weightedConductivity.begin(), weightedConductivity.end(), 0.0) / totalVolume;
 }
 
 void Cell::calcCellADEUp(double timestep, const Foundation &foundation,
                          const BoundaryConditions & /*bcs*/, double &U) {
-  double theta = timestep * iHeatCapacity;
-
   double C[3][2]{{0}};
-  gatherCCoeffs(theta, foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
-
-  double bit{1}, divisor{1};
-  U = heatGain * theta;
-  for (auto dim : dims) {
-    if (dim < 5) {
-      bit -= C[dim][1];
-      divisor -= C[dim][0];
-      U += *(told_ptr + stepsize[dim]) * C[dim][1] - *(&U - stepsize[dim]) * C[dim][0];
-    }
-  }
-  U = (*told_ptr * bit + U) / divisor;
+  gatherCCoeffs(timestep * iHeatCapacity(),
+                foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
+  store->calcCellADEUp<0>(index, timestep, C, &U - index);
 }
 
 void Cell::calcCellADEDown(double timestep, const Foundation &foundation,
                            const BoundaryConditions & /*bcs*/, double &V) {
-  double theta = timestep * iHeatCapacity;
-
   double C[3][2]{{0}};
-  gatherCCoeffs(theta, foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
-
-  double bit{1}, divisor{1};
-  V = heatGain * theta;
-  for (auto dim : dims) {
-    if (dim < 5) {
-      bit += C[dim][0];
-      divisor += C[dim][1];
-      V += *(&V + stepsize[dim]) * C[dim][1] - *(told_ptr - stepsize[dim]) * C[dim][0];
-    }
-  }
-  V = (*told_ptr * bit + V) / divisor;
+  gatherCCoeffs(timestep * iHeatCapacity(),
+                foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
+  store->calcCellADEDown<0>(index, timestep, C, &V - index);
 }
 
 double Cell::calcCellExplicit(double timestep, const Foundation &foundation,
                               const BoundaryConditions & /*bcs*/) {
-  double theta = timestep * iHeatCapacity;
-
   double C[3][2]{{0}};
-  gatherCCoeffs(theta, foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
-
-  double bit{1};
-  double TNew = heatGain * theta;
-  for (auto dim : dims) {
-    if (dim < 5) {
-      bit += C[dim][0] - C[dim][1];
-      TNew += *(told_ptr + stepsize[dim]) * C[dim][1] - *(told_ptr - stepsize[dim]) * C[dim][0];
-    }
-  }
-  TNew += *told_ptr * bit;
-  return TNew;
+  gatherCCoeffs(timestep * iHeatCapacity(),
+                foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
+  return store->calcCellExplicit<0>(index, timestep, C);
 }
 
 void Cell::calcCellMatrix(Foundation::NumericalScheme scheme, const double &timestep,
@@ -209,103 +210,33 @@ void Cell::calcCellMatrix(Foundation::NumericalScheme scheme, const double &time
   if (scheme == Foundation::NS_STEADY_STATE) {
     calcCellSteadyState(foundation, A, Alt, bVal);
   } else {
-    double theta = timestep * iHeatCapacity;
-
-    double f = scheme == Foundation::NS_IMPLICIT ? 1.0 : 0.5;
-
-    bool cylindrical = (foundation.coordinateSystem == Foundation::CS_CYLINDRICAL);
     double C[3][2]{{0}};
-    gatherCCoeffs(theta, cylindrical, C);
-
-    double bit{0};
-    bVal = heatGain * theta;
-    for (auto dim : dims) {
-      if (dim < 5) {
-        bit += C[dim][1] - C[dim][0];
-        Alt[dim][1] = -f * C[dim][1];
-        Alt[dim][0] = f * C[dim][0];
-        bVal += *(told_ptr + stepsize[dim]) * (1 - f) * C[dim][1] -
-                *(told_ptr - stepsize[dim]) * (1 - f) * C[dim][0];
-      }
-    }
-    A = (1.0 + f * bit);
-    bVal += *told_ptr * (1.0 - (1 - f) * bit);
+    gatherCCoeffs(timestep * iHeatCapacity(),
+                  foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
+    store->calcCellMatrix<0>(index, scheme, timestep, C, A, Alt, bVal);
   }
 }
 
 void Cell::calcCellSteadyState(const Foundation &foundation, double &A, double (&Alt)[3][2],
                                double &bVal) {
-
-  A = 0;
-  for (auto dim : dims) {
-    if (dim < 5) {
-      Alt[dim][1] = pde[dim][1];
-      Alt[dim][0] = -pde[dim][0];
-      A += Alt[dim][1] + Alt[dim][0];
-    }
-  }
-  if (foundation.coordinateSystem == Foundation::CS_CYLINDRICAL && coords[0] != 0) {
-    Alt[0][1] += pde_c[1] / r;
-    Alt[0][0] += -pde_c[0] / r;
-    A += pde_c[1] / r - pde_c[0] / r;
+  if (foundation.coordinateSystem == Foundation::CS_CYLINDRICAL) {
+    store->calcCellSteadyState<0, true>(index, A, Alt, bVal);
+  } else {
+    store->calcCellSteadyState<0, false>(index, A, Alt, bVal);
   }
-  A *= -1;
-  bVal = -heatGain;
 }
 
 void Cell::calcCellADI(std::size_t dim, const double &timestep, const Foundation &foundation,
                        const BoundaryConditions & /*bcs*/, double &A, double (&Alt)[2],
                        double &bVal) {
-  double theta = timestep * iHeatCapacityADI;
-
-  double Q = heatGain * theta;
-
-  if (foundation.numberOfDimensions == 1) {
-    A = 1.0 + (pde[2][1] - pde[2][0]) * theta;
-    Alt[0] = pde[2][0] * theta;
-    Alt[1] = -pde[2][1] * theta;
-
-    bVal = *told_ptr + Q;
-    return;
-  }
-
-  double f = foundation.fADI;
-  double multiplier = foundation.numberOfDimensions == 2 ? (2.0 - f) : (3.0 - 2.0 * f);
   double C[3][2]{{0}};
-  gatherCCoeffs(theta, foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
-
-  ADImath(dim, Q, f, multiplier, C, A, Alt, bVal);
-}
-
-void Cell::ADImath(std::size_t dim, const double Q, const double f, const double multiplier,
-                   const double (&C)[3][2], double &A, double (&Alt)[2], double &bVal) {
-  bVal = Q;
-  double bit{0};
-  for (auto sdim : dims) {
-    if (sdim == dim) {
-      Alt[0] = multiplier * C[sdim][0];
-      Alt[1] = -multiplier * C[sdim][1];
-      A = 1.0 - (Alt[0] + Alt[1]);
-    } else if (sdim < 5) {
-      bit += C[sdim][0] - C[sdim][1];
-      bVal += *(told_ptr + stepsize[sdim]) * f * C[sdim][1] -
-              *(told_ptr - stepsize[sdim]) * f * C[sdim][0];
-    }
-  }
-  bVal += *told_ptr * (1.0 + f * bit);
+  gatherCCoeffs(store->thetaADI(index, timestep),
+                foundation.coordinateSystem == Foundation::CS_CYLINDRICAL, C);
+  store->calcCellADI<0>(index, dim, timestep, foundation.fADI, C, A, Alt, bVal);
 }
 
 void Cell::gatherCCoeffs(const double &theta, bool cylindrical, double (&C)[3][2]) {
-  for (auto dim : dims) {
-    if (dim < 5) {
-      C[dim][0] = pde[dim][0] * theta;
-      C[dim][1] = pde[dim][1] * theta;
-    }
-  }
-  if (cylindrical && coords[0] != 0) {
-    C[0][0] += pde_c[0] * theta / r;
-    C[0][1] += pde_c[1] * theta / r;
-  }
+  store->gatherCCoeffs(index, theta, cylindrical, C);
 }
 
 std::vector<double> Cell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::size_t nY,
@@ -320,17 +251,17 @@ std::vector<double> Cell::calculateHeatFlux(int ndims, double &TNew, std::size_t
   double CXM = 0;
   double CYP = 0;
   double CYM = 0;
-  double CZP = -kcoeff[2][1] * dist[2][0] / (dist[2][1] + dist[2][0]) / dist[2][1];
-  double CZM = -kcoeff[2][0] * dist[2][1] / (dist[2][1] + dist[2][0]) / dist[2][0];
+  double CZP = -kcoeff(2, 1) * dist(2, 0) / (dist(2, 1) + dist(2, 0)) / dist(2, 1);
+  double CZM = -kcoeff(2, 0) * dist(2, 1) / (dist(2, 1) + dist(2, 0)) / dist(2, 0);
 
   if (ndims > 1) {
-    CXP = -kcoeff[0][1] * dist[0][0] / (dist[0][1] + dist[0][0]) / dist[0][1];
-    CXM = -kcoeff[0][0] * dist[0][1] / (dist[0][1] + dist[0][0]) / dist[0][0];
+    CXP = -kcoeff(0, 1) * dist(0, 0) / (dist(0, 1) + dist(0, 0)) / dist(0, 1);
+    CXM = -kcoeff(0, 0) * dist(0, 1) / (dist(0, 1) + dist(0, 0)) / dist(0, 0);
   }
 
   if (ndims == 3) {
-    CYP = -kcoeff[1][1] * dist[1][0] / (dist[1][1] + dist[1][0]) / dist[1][1];
-    CYM = -kcoeff[1][0] * dist[1][1] / (dist[1][1] + dist[1][0]) / dist[1][0];
+    CYP = -kcoeff(1, 1) * dist(1, 0) / (dist(1, 1) + dist(1, 0)) / dist(1, 1);
+    CYM = -kcoeff(1, 0) * dist(1, 1) / (dist(1, 1) + dist(1, 0)) / dist(1, 0);
   }
 
   double DTXP = 0;
@@ -341,22 +272,22 @@ std::vector<double> Cell::calculateHeatFlux(int ndims, double &TNew, std::size_t
   double DTZM = 0;
 
   if (coords[0] != nX - 1)
-    DTXP = *(&TNew + stepsize[0]) - TNew;
+    DTXP = *(&TNew + stepsize()[0]) - TNew;
 
   if (coords[0] != 0)
-    DTXM = TNew - *(&TNew - stepsize[0]);
+    DTXM = TNew - *(&TNew - stepsize()[0]);
 
   if (coords[1] != nY - 1)
-    DTYP = *(&TNew + stepsize[1]) - TNew;
+    DTYP = *(&TNew + stepsize()[1]) - TNew;
 
   if (coords[1] != 0)
-    DTYM = TNew - *(&TNew - stepsize[1]);
+    DTYM = TNew - *(&TNew - stepsize()[1]);
 
   if (coords[2] != nZ - 1)
-    DTZP = *(&TNew + stepsize[2]) - TNew;
+    DTZP = *(&TNew + stepsize()[2]) - TNew;
 
   if (coords[2] != 0)
-    DTZM = TNew - *(&TNew - stepsize[2]);
+    DTZM = TNew - *(&TNew - stepsize()[2]);
 
   Qx = CXP * DTXP + CXM * DTXM;
   Qy = CYP * DTYP + CYM * DTYM;
@@ -381,9 +312,9 @@ void Cell::doIndoorTemp(const BoundaryConditions &bcs, double &A, double &bVal)
 
 ExteriorAirCell::ExteriorAirCell(const std::size_t &index, const CellType cellType,
                                  const std::size_t &i, const std::size_t &j, const std::size_t &k,
-                                 std::size_t *stepsize, const Foundation &foundation,
-                                 Surface *surfacePtr, Block *blockPtr, Mesher *meshPtr)
-    : Cell(index, cellType, i, j, k, stepsize, foundation, surfacePtr, blockPtr, meshPtr) {}
+                                 const std::shared_ptr<CellStore> &store,
+                                 const Foundation &foundation, Surface *surfacePtr, Block *blockPtr)
+    : Cell(index, cellType, i, j, k, store, foundation, surfacePtr, blockPtr) {}
 
 void ExteriorAirCell::calcCellADEUp(double /*timestep*/, const Foundation & /*foundation*/,
                                     const BoundaryConditions &bcs, double &U) {
@@ -425,9 +356,9 @@ ExteriorAirCell::calculateHeatFlux(int /*ndims*/, double & /*TNew*/, std::size_t
 
 InteriorAirCell::InteriorAirCell(const std::size_t &index, const CellType cellType,
                                  const std::size_t &i, const std::size_t &j, const std::size_t &k,
-                                 std::size_t *stepsize, const Foundation &foundation,
-                                 Surface *surfacePtr, Block *blockPtr, Mesher *meshPtr)
-    : Cell(index, cellType, i, j, k, stepsize, foundation, surfacePtr, blockPtr, meshPtr) {}
+                                 const std::shared_ptr<CellStore> &store,
+                                 const Foundation &foundation, Surface *surfacePtr, Block *blockPtr)
+    : Cell(index, cellType, i, j, k, store, foundation, surfacePtr, blockPtr) {}
 
 void InteriorAirCell::calcCellADEUp(double /*timestep*/, const Foundation & /*foundation*/,
                                     const BoundaryConditions &bcs, double &U) {
@@ -468,65 +399,65 @@ InteriorAirCell::calculateHeatFlux(int /*ndims*/, double & /*TNew*/, std::size_t
 }
 
 BoundaryCell::BoundaryCell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-                           const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-                           const Foundation &foundation, Surface *surfacePtr, Block *blockPtr,
-                           Mesher *meshPtr)
-    : Cell(index, cellType, i, j, k, stepsize, foundation, surfacePtr, blockPtr, meshPtr) {
+                           const std::size_t &j, const std::size_t &k,
+                           const std::shared_ptr<CellStore> &store,
+                           const Foundation &foundation, Surface *surfacePtr, Block *blockPtr)
+    : Cell(index, cellType, i, j, k, store, foundation, surfacePtr, blockPtr) {
   if (foundation.numberOfDimensions == 2 &&
       foundation.coordinateSystem == Foundation::CS_CYLINDRICAL) {
     if (surfacePtr->orientation == Surface::X_POS || surfacePtr->orientation == Surface::X_NEG) {
-      area = 2.0 * PI * meshPtr[0].centers[coords[0]] * meshPtr[2].deltas[coords[2]];
+      area() = 2.0 * PI * meshPtr()[0].centers[coords[0]] * meshPtr()[2].deltas[coords[2]];
     } else // if (surface.orientation == Surface::Z_POS ||
            // surface.orientation == Surface::Z_NEG)
     {
-      area = PI * (meshPtr[0].dividers[coords[0] + 1] * meshPtr[0].dividers[coords[0] + 1] -
-                   meshPtr[0].dividers[coords[0]] * meshPtr[0].dividers[coords[0]]);
+      area() = PI * (meshPtr()[0].dividers[coords[0] + 1] * meshPtr()[0].dividers[coords[0] + 1] -
+                   meshPtr()[0].dividers[coords[0]] * meshPtr()[0].dividers[coords[0]]);
     }
   } else if (foundation.numberOfDimensions == 2 &&
              foundation.coordinateSystem == Foundation::CS_CARTESIAN) {
     if (surfacePtr->orientation == Surface::X_POS || surfacePtr->orientation == Surface::X_NEG) {
-      area = 2.0 * meshPtr[2].deltas[coords[2]] * foundation.linearAreaMultiplier;
+      area() = 2.0 * meshPtr()[2].deltas[coords[2]] * foundation.linearAreaMultiplier;
     } else // if (surface.orientation == Surface::Z_POS ||
            // surface.orientation == Surface::Z_NEG)
     {
-      area = 2.0 * meshPtr[0].deltas[coords[0]] * foundation.linearAreaMultiplier;
+      area() = 2.0 * meshPtr()[0].deltas[coords[0]] * foundation.linearAreaMultiplier;
     }
   } else if (foundation.numberOfDimensions == 3) {
     if (surfacePtr->orientation == Surface::X_POS || surfacePtr->orientation == Surface::X_NEG) {
-      area = meshPtr[1].deltas[coords[1]] * meshPtr[2].deltas[coords[2]];
+      area() = meshPtr()[1].deltas[coords[1]] * meshPtr()[2].deltas[coords[2]];
     } else if (surfacePtr->orientation == Surface::Y_POS ||
                surfacePtr->orientation == Surface::Y_NEG) {
-      area = meshPtr[0].deltas[coords[0]] * meshPtr[2].deltas[coords[2]];
+      area() = meshPtr()[0].deltas[coords[0]] * meshPtr()[2].deltas[coords[2]];
     } else // if (surface.orientation == Surface::Z_POS ||
            // surface.orientation == Surface::Z_NEG)
     {
-      area = meshPtr[0].deltas[coords[0]] * meshPtr[1].deltas[coords[1]];
+      area() = meshPtr()[0].deltas[coords[0]] * meshPtr()[1].deltas[coords[1]];
     }
 
     if (foundation.useSymmetry) {
       if (foundation.isXSymm)
-        area = 2 * area;
+        area() = 2 * area();
 
       if (foundation.isYSymm)
-        area = 2 * area;
+        area() = 2 * area();
     }
   } else /* if (foundation.numberOfDimensions == 1) */
   {
-    area = 1.0;
+    area() = 1.0;
   }
 }
 
 void BoundaryCell::calcCellADEUp(double /*timestep*/, const Foundation & /*foundation*/,
                                  const BoundaryConditions &bcs, double &U) {
-  std::size_t dim = surfacePtr->orientation_dim;
-  std::size_t dir = surfacePtr->orientation_dir;
+  std::size_t dim = surfacePtr()->orientation_dim;
+  std::size_t dir = surfacePtr()->orientation_dir;
 
-  switch (surfacePtr->boundaryConditionType) {
+  switch (surfacePtr()->boundaryConditionType) {
   case Surface::ZERO_FLUX:
     zfCellADEUp(dim, dir, U);
     break;
   case Surface::CONSTANT_TEMPERATURE:
-    U = surfacePtr->temperature;
+    U = surfacePtr()->temperature;
     break;
   case Surface::INTERIOR_TEMPERATURE:
     U = bcs.slabConvectiveTemp;
@@ -545,15 +476,15 @@ void BoundaryCell::calcCellADEUp(double /*timestep*/, const Foundation & /*found
 
 void BoundaryCell::calcCellADEDown(double /*timestep*/, const Foundation & /*foundation*/,
                                    const BoundaryConditions &bcs, double &V) {
-  std::size_t dim = surfacePtr->orientation_dim;
-  std::size_t dir = surfacePtr->orientation_dir;
+  std::size_t dim = surfacePtr()->orientation_dim;
+  std::size_t dir = surfacePtr()->orientation_dir;
 
-  switch (surfacePtr->boundaryConditionType) {
+  switch (surfacePtr()->boundaryConditionType) {
   case Surface::ZERO_FLUX:
     zfCellADEDown(dim, dir, V);
     break;
   case Surface::CONSTANT_TEMPERATURE:
-    V = surfacePtr->temperature;
+    V = surfacePtr()->temperature;
     break;
   case Surface::INTERIOR_TEMPERATURE:
     V = bcs.slabConvectiveTemp;
@@ -572,14 +503,14 @@ void BoundaryCell::calcCellADEDown(double /*timestep*/, const Foundation & /*fou
 
 double BoundaryCell::calcCellExplicit(double /*timestep*/, const Foundation & /*foundation*/,
                                       const BoundaryConditions &bcs) {
-  std::size_t dim = surfacePtr->orientation_dim;
-  std::size_t dir = surfacePtr->orientation_dir;
+  std::size_t dim = surfacePtr()->orientation_dim;
+  std::size_t dir = surfacePtr()->orientation_dir;
 
-  switch (surfacePtr->boundaryConditionType) {
+  switch (surfacePtr()->boundaryConditionType) {
   case Surface::ZERO_FLUX:
     return zfCellExplicit(dim, dir);
   case Surface::CONSTANT_TEMPERATURE:
-    return surfacePtr->temperature;
+    return surfacePtr()->temperature;
   case Surface::INTERIOR_TEMPERATURE:
     return bcs.slabConvectiveTemp;
   case Surface::EXTERIOR_TEMPERATURE:
@@ -594,16 +525,16 @@ double BoundaryCell::calcCellExplicit(double /*timestep*/, const Foundation & /*
 void BoundaryCell::calcCellADI(std::size_t dim, const double & /*timestep*/,
                                const Foundation & /*foundation*/, const BoundaryConditions &bcs,
                                double &A, double (&Alt)[2], double &bVal) {
-  std::size_t sdim = surfacePtr->orientation_dim;
-  std::size_t dir = surfacePtr->orientation_dir;
+  std::size_t sdim = surfacePtr()->orientation_dim;
+  std::size_t dir = surfacePtr()->orientation_dir;
 
-  switch (surfacePtr->boundaryConditionType) {
+  switch (surfacePtr()->boundaryConditionType) {
   case Surface::ZERO_FLUX:
     zfCellADI(dim, sdim, dir, A, Alt[dir], bVal);
     break;
   case Surface::CONSTANT_TEMPERATURE:
     A = 1.0;
-    bVal = surfacePtr->temperature;
+    bVal = surfacePtr()->temperature;
     break;
   case Surface::INTERIOR_TEMPERATURE:
     doIndoorTemp(bcs, A, bVal);
@@ -623,17 +554,17 @@ void BoundaryCell::calcCellADI(std::size_t dim, const double & /*timestep*/,
 void BoundaryCell::calcCellMatrix(Foundation::NumericalScheme, const double & /*timestep*/,
                                   const Foundation & /*foundation*/, const BoundaryConditions &bcs,
                                   double &A, double (&Alt)[3][2], double &bVal) {
-  std::size_t dim = surfacePtr->orientation_dim;
-  std::size_t dir = surfacePtr->orientation_dir;
+  std::size_t dim = surfacePtr()->orientation_dim;
+  std::size_t dir = surfacePtr()->orientation_dir;
 
-  switch (surfacePtr->boundaryConditionType) {
+  switch (surfacePtr()->boundaryConditionType) {
   case Surface::ZERO_FLUX: {
     zfCellMatrix(A, Alt[dim][dir], bVal);
     break;
   }
   case Surface::CONSTANT_TEMPERATURE: {
     A = 1.0;
-    bVal = surfacePtr->temperature;
+    bVal = surfacePtr()->temperature;
     break;
   }
   case Surface::INTERIOR_TEMPERATURE: {
@@ -668,17 +599,17 @@ BoundaryCell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::si
   double CXM = 0;
   double CYP = 0;
   double CYM = 0;
-  double CZP = -kcoeff[2][1] * dist[2][0] / (dist[2][1] + dist[2][0]) / dist[2][1];
-  double CZM = -kcoeff[2][0] * dist[2][1] / (dist[2][1] + dist[2][0]) / dist[2][0];
+  double CZP = -kcoeff(2, 1) * dist(2, 0) / (dist(2, 1) + dist(2, 0)) / dist(2, 1);
+  double CZM = -kcoeff(2, 0) * dist(2, 1) / (dist(2, 1) + dist(2, 0)) / dist(2, 0);
 
   if (ndims > 1) {
-    CXP = -kcoeff[0][1] * dist[0][0] / (dist[0][1] + dist[0][0]) / dist[0][1];
-    CXM = -kcoeff[0][0] * dist[0][1] / (dist[0][1] + dist[0][0]) / dist[0][0];
+    CXP = -kcoeff(0, 1) * dist(0, 0) / (dist(0, 1) + dist(0, 0)) / dist(0, 1);
+    CXM = -kcoeff(0, 0) * dist(0, 1) / (dist(0, 1) + dist(0, 0)) / dist(0, 0);
   }
 
   if (ndims == 3) {
-    CYP = -kcoeff[1][1] * dist[1][0] / (dist[1][1] + dist[1][0]) / dist[1][1];
-    CYM = -kcoeff[1][0] * dist[1][1] / (dist[1][1] + dist[1][0]) / dist[1][0];
+    CYP = -kcoeff(1, 1) * dist(1, 0) / (dist(1, 1) + dist(1, 0)) / dist(1, 1);
+    CYM = -kcoeff(1, 0) * dist(1, 1) / (dist(1, 1) + dist(1, 0)) / dist(1, 0);
   }
 
   double DTXP = 0;
@@ -689,47 +620,47 @@ BoundaryCell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::si
   double DTZM = 0;
 
   if (coords[0] != nX - 1)
-    DTXP = *(&TNew + stepsize[0]) - TNew;
+    DTXP = *(&TNew + stepsize()[0]) - TNew;
 
   if (coords[0] != 0)
-    DTXM = TNew - *(&TNew - stepsize[0]);
+    DTXM = TNew - *(&TNew - stepsize()[0]);
 
   if (coords[1] != nY - 1)
-    DTYP = *(&TNew + stepsize[1]) - TNew;
+    DTYP = *(&TNew + stepsize()[1]) - TNew;
 
   if (coords[1] != 0)
-    DTYM = TNew - *(&TNew - stepsize[1]);
+    DTYM = TNew - *(&TNew - stepsize()[1]);
 
   if (coords[2] != nZ - 1)
-    DTZP = *(&TNew + stepsize[2]) - TNew;
+    DTZP = *(&TNew + stepsize()[2]) - TNew;
 
   if (coords[2] != 0)
-    DTZM = TNew - *(&TNew - stepsize[2]);
+    DTZM = TNew - *(&TNew - stepsize()[2]);
 
-  switch (surfacePtr->orientation) {
+  switch (surfacePtr()->orientation) {
   case Surface::X_NEG: {
-    CXP = -kcoeff[0][1] / dist[0][1];
+    CXP = -kcoeff(0, 1) / dist(0, 1);
     CXM = 0;
   } break;
   case Surface::X_POS: {
     CXP = 0;
-    CXM = -kcoeff[0][0] / dist[0][0];
+    CXM = -kcoeff(0, 0) / dist(0, 0);
   } break;
   case Surface::Y_NEG: {
-    CYP = -kcoeff[1][1] / dist[1][1];
+    CYP = -kcoeff(1, 1) / dist(1, 1);
     CYM = 0;
   } break;
   case Surface::Y_POS: {
     CYP = 0;
-    CYM = -kcoeff[1][0] / dist[1][0];
+    CYM = -kcoeff(1, 0) / dist(1, 0);
   } break;
   case Surface::Z_NEG: {
-    CZP = -kcoeff[2][1] / dist[2][1];
+    CZP = -kcoeff(2, 1) / dist(2, 1);
     CZM = 0;
   } break;
   case Surface::Z_POS: {
     CZP = 0;
-    CZM = -kcoeff[2][0] / dist[2][0];
+    CZM = -kcoeff(2, 0) / dist(2, 0);
   } break;
   }
   Qx = CXP * DTXP + CXM * DTXM;
@@ -744,20 +675,20 @@ BoundaryCell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::si
 }
 
 #define INTFLUX_PREFACE                                                                            \
-  double Tair = surfacePtr->temperature;                                                           \
-  double Trad = surfacePtr->radiantTemperature;                                                    \
-  double cosTilt = surfacePtr->cosTilt;                                                            \
-  double hc = surfacePtr->convectionAlgorithm(*told_ptr, Tair, surfacePtr->hfTerm,                 \
-                                              surfacePtr->propPtr->roughness, cosTilt);            \
-  double hr = getSimpleInteriorIRCoeff(surfacePtr->propPtr->emissivity, *told_ptr, Trad);
+  double Tair = surfacePtr()->temperature;                                                         \
+  double Trad = surfacePtr()->radiantTemperature;                                                  \
+  double cosTilt = surfacePtr()->cosTilt;                                                          \
+  double hc = surfacePtr()->convectionAlgorithm(*told_ptr(), Tair, surfacePtr()->hfTerm,        \
+                                                   surfacePtr()->propPtr->roughness, cosTilt);     \
+  double hr = getSimpleInteriorIRCoeff(surfacePtr()->propPtr->emissivity, *told_ptr(), Trad);
 
 #define EXTFLUX_PREFACE                                                                            \
-  double Tair = surfacePtr->temperature;                                                           \
-  double cosTilt = surfacePtr->cosTilt;                                                            \
-  double Fqtr = surfacePtr->effectiveLWViewFactorQtr;                                              \
-  double hc = surfacePtr->convectionAlgorithm(*told_ptr, Tair, surfacePtr->hfTerm,                 \
-                                              surfacePtr->propPtr->roughness, cosTilt);            \
-  double hr = getExteriorIRCoeff(surfacePtr->propPtr->emissivity, *told_ptr, Tair, Fqtr);
+  double Tair = surfacePtr()->temperature;                                                         \
+  double cosTilt = surfacePtr()->cosTilt;                                                          \
+  double Fqtr = surfacePtr()->effectiveLWViewFactorQtr;                                            \
+  double hc = surfacePtr()->convectionAlgorithm(*told_ptr(), Tair, surfacePtr()->hfTerm,        \
+                                                   surfacePtr()->propPtr->roughness, cosTilt);     \
+  double hr = getExteriorIRCoeff(surfacePtr()->propPtr->emissivity, *told_ptr(), Tair, Fqtr);
 
 void BoundaryCell::zfCellADI(const int &dim, const int &sdim, const int &sign, double &A,
                              double &Alt, double &bVal) {
@@ -767,7 +698,7 @@ void BoundaryCell::zfCellADI(const int &dim, const int &sdim, const int &sign, d
     bVal = 0;
   } else {
     Alt = 0.0;
-    bVal = *(told_ptr + sign * stepsize[sdim]);
+    bVal = *(told_ptr() + sign * stepsize()[sdim]);
   }
 }
 
@@ -776,14 +707,14 @@ void BoundaryCell::ifCellADI(const int &dim, const int &sdim, const int &dir, do
 
   int sign = (dir == 0) ? -1 : 1;
 
-  A = kcoeff[sdim][dir] / dist[sdim][dir] + (hc + hr);
+  A = kcoeff(sdim, dir) / dist(sdim, dir) + (hc + hr);
   if (dim == sdim) {
-    Alt = -kcoeff[sdim][dir] / dist[sdim][dir];
-    bVal = (hc + hr) * Tair + heatGain;
+    Alt = -kcoeff(sdim, dir) / dist(sdim, dir);
+    bVal = (hc + hr) * Tair + heatGain();
   } else {
     Alt = 0.0;
-    bVal = *(told_ptr + sign * stepsize[sdim]) * kcoeff[sdim][dir] / dist[sdim][dir] +
-           (hc + hr) * Tair + heatGain;
+    bVal = *(told_ptr() + sign * stepsize()[sdim]) * kcoeff(sdim, dir) / dist(sdim, dir) +
+           (hc + hr) * Tair + heatGain();
   }
 }
 
@@ -792,14 +723,14 @@ void BoundaryCell::efCellADI(const int &dim, const int &sdim, const int &dir, do
 
   int sign = (dir == 0) ? -1 : 1;
 
-  A = kcoeff[sdim][dir] / dist[sdim][dir] + (hc + hr);
+  A = kcoeff(sdim, dir) / dist(sdim, dir) + (hc + hr);
   if (dim == sdim) {
-    Alt = -kcoeff[sdim][dir] / dist[sdim][dir];
-    bVal = (hc + hr * Fqtr) * Tair + heatGain;
+    Alt = -kcoeff(sdim, dir) / dist(sdim, dir);
+    bVal = (hc + hr * Fqtr) * Tair + heatGain();
   } else {
     Alt = 0.0;
-    bVal = *(told_ptr + sign * stepsize[sdim]) * kcoeff[sdim][dir] / dist[sdim][dir] +
-           (hc + hr * Fqtr) * Tair + heatGain;
+    bVal = *(told_ptr() + sign * stepsize()[sdim]) * kcoeff(sdim, dir) / dist(sdim, dir) +
+           (hc + hr * Fqtr) * Tair + heatGain();
   }
 }
 
@@ -812,24 +743,24 @@ void BoundaryCell::zfCellMatrix(double &A, double &Alt, double &bVal) {
 void BoundaryCell::ifCellMatrix(const int &dim, const int &dir, double &A, double &Alt, double &bVal) {
   INTFLUX_PREFACE
 
-  A = kcoeff[dim][dir] / dist[dim][dir] + (hc + hr);
-  Alt = -kcoeff[dim][dir] / dist[dim][dir];
-  bVal = (hc + hr) * Tair + heatGain;
+  A = kcoeff(dim, dir) / dist(dim, dir) + (hc + hr);
+  Alt = -kcoeff(dim, dir) / dist(dim, dir);
+  bVal = (hc + hr) * Tair + heatGain();
 }
 
 void BoundaryCell::efCellMatrix(const int &dim, const int &dir, double &A, double &Alt, double &bVal) {
   EXTFLUX_PREFACE
 
-  A = kcoeff[dim][dir] / dist[dim][dir] + (hc + hr);
-  Alt = -kcoeff[dim][dir] / dist[dim][dir];
-  bVal = (hc + hr * Fqtr) * Tair + heatGain;
+  A = kcoeff(dim, dir) / dist(dim, dir) + (hc + hr);
+  Alt = -kcoeff(dim, dir) / dist(dim, dir);
+  bVal = (hc + hr * Fqtr) * Tair + heatGain();
 }
 
 void BoundaryCell::zfCellADEUp(const std::size_t &dim, const std::size_t &dir, double &U) {
   if (dir == 1) {
-    U = *(told_ptr + stepsize[dim]);
+    U = *(told_ptr() + stepsize()[dim]);
   } else /* if (dir == 0) */ {
-    U = *(&U - stepsize[dim]);
+    U = *(&U - stepsize()[dim]);
   }
 }
 
@@ -838,12 +769,12 @@ void BoundaryCell::ifCellADEUp(const int &dim, const int &dir, double &U) {
 
   double bit;
   if (dir == 1) {
-    bit = *(told_ptr + stepsize[dim]);
+    bit = *(told_ptr() + stepsize()[dim]);
   } else /*if (dir == 0)*/ {
-    bit = *(&U - stepsize[dim]);
+    bit = *(&U - stepsize()[dim]);
   }
-  U = (kcoeff[dim][dir] * bit / dist[dim][dir] + (hc + hr) * Tair + heatGain) /
-      (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  U = (kcoeff(dim, dir) * bit / dist(dim, dir) + (hc + hr) * Tair + heatGain()) /
+      (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 void BoundaryCell::efCellADEUp(const int &dim, const int &dir, double &U) {
@@ -851,19 +782,19 @@ void BoundaryCell::efCellADEUp(const int &dim, const int &dir, double &U) {
 
   double bit;
   if (dir == 1) {
-    bit = *(told_ptr + stepsize[dim]);
+    bit = *(told_ptr() + stepsize()[dim]);
   } else /*if (dir == 0)*/ {
-    bit = *(&U - stepsize[dim]);
+    bit = *(&U - stepsize()[dim]);
   }
-  U = (kcoeff[dim][dir] * bit / dist[dim][dir] + (hc + hr * Fqtr) * Tair + heatGain) /
-      (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  U = (kcoeff(dim, dir) * bit / dist(dim, dir) + (hc + hr * Fqtr) * Tair + heatGain()) /
+      (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 void BoundaryCell::zfCellADEDown(const std::size_t &dim, const std::size_t &dir, double &V) {
   if (dir == 1) {
-    V = *(&V + stepsize[dim]);
+    V = *(&V + stepsize()[dim]);
   } else /* if (dir == 0) */ {
-    V = *(told_ptr - stepsize[dim]);
+    V = *(told_ptr() - stepsize()[dim]);
   }
 }
 
@@ -872,12 +803,12 @@ void BoundaryCell::ifCellADEDown(const int &dim, const int &dir, double &V) {
 
   double bit;
   if (dir == 1) {
-    bit = *(&V + stepsize[dim]);
+    bit = *(&V + stepsize()[dim]);
   } else /*if (dir == 0)*/ {
-    bit = *(told_ptr - stepsize[dim]);
+    bit = *(told_ptr() - stepsize()[dim]);
   }
-  V = (kcoeff[dim][dir] * bit / dist[dim][dir] + (hc + hr) * Tair + heatGain) /
-      (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  V = (kcoeff(dim, dir) * bit / dist(dim, dir) + (hc + hr) * Tair + heatGain()) /
+      (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 void BoundaryCell::efCellADEDown(const int &dim, const int &dir, double &V) {
@@ -885,17 +816,17 @@ void BoundaryCell::efCellADEDown(const int &dim, const int &dir, double &V) {
 
   double bit;
   if (dir == 1) {
-    bit = *(&V + stepsize[dim]);
+    bit = *(&V + stepsize()[dim]);
   } else /*if (dir == 0)*/ {
-    bit = *(told_ptr - stepsize[dim]);
+    bit = *(told_ptr() - stepsize()[dim]);
   }
-  V = (kcoeff[dim][dir] * bit / dist[dim][dir] + (hc + hr * Fqtr) * Tair + heatGain) /
-      (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  V = (kcoeff(dim, dir) * bit / dist(dim, dir) + (hc + hr * Fqtr) * Tair + heatGain()) /
+      (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 double BoundaryCell::zfCellExplicit(const std::size_t &dim, const std::size_t &dir) {
   int sign = (dir == 0) ? -1 : 1;
-  return *(told_ptr + sign * stepsize[dim]);
+  return *(told_ptr() + sign * stepsize()[dim]);
 }
 
 double BoundaryCell::ifCellExplicit(const std::size_t &dim, const std::size_t &dir) {
@@ -903,25 +834,27 @@ double BoundaryCell::ifCellExplicit(const std::size_t &dim, const std::size_t &d
 
   int sign = (dir == 0) ? -1 : 1;
 
-  return (kcoeff[dim][dir] * *(told_ptr + sign * stepsize[dim]) / dist[dim][dir] +
-          (hc + hr) * Tair + heatGain) /
-         (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  return (kcoeff(dim, dir) * *(told_ptr() + sign * stepsize()[dim]) / dist(dim, dir) +
+          (hc + hr) * Tair + heatGain()) /
+         (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 double BoundaryCell::efCellExplicit(const std::size_t &dim, const std::size_t &dir) {
   EXTFLUX_PREFACE
 
-  return (kcoeff[dim][dir] * *(told_ptr + stepsize[dim]) / dist[dim][dir] +
-          (hc + hr * Fqtr) * Tair + heatGain) /
-         (kcoeff[dim][dir] / dist[dim][dir] + (hc + hr));
+  int sign = (dir == 0) ? -1 : 1;
+
+  return (kcoeff(dim, dir) * *(told_ptr() + sign * stepsize()[dim]) / dist(dim, dir) +
+          (hc + hr * Fqtr) * Tair + heatGain()) /
+         (kcoeff(dim, dir) / dist(dim, dir) + (hc + hr));
 }
 
 ZeroThicknessCell::ZeroThicknessCell(const std::size_t &index, const CellType cellType,
                                      const std::size_t &i, const std::size_t &j,
-                                     const std::size_t &k, std::size_t *stepsize,
+                                     const std::size_t &k, const std::shared_ptr<CellStore> &store,
                                      const Foundation &foundation, Surface *surfacePtr,
-                                     Block *blockPtr, Mesher *meshPtr)
-    : Cell(index, cellType, i, j, k, stepsize, foundation, surfacePtr, blockPtr, meshPtr) {}
+                                     Block *blockPtr)
+    : Cell(index, cellType, i, j, k, store, foundation, surfacePtr, blockPtr) {}
 
 std::vector<double>
 ZeroThicknessCell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::size_t nY,
@@ -935,23 +868,23 @@ ZeroThicknessCell::calculateHeatFlux(int ndims, double &TNew, std::size_t nX, st
   std::vector<double> Qm;
   std::vector<double> Qp;
 
-  if (isEqual(meshPtr[0].deltas[coords[0]], 0.0)) {
-    Qm = cell_v[index - stepsize[0]]->calculateHeatFlux(ndims, *(&TNew - stepsize[0]), nX, nY, nZ,
-                                                        cell_v);
-    Qp = cell_v[index + stepsize[0]]->calculateHeatFlux(ndims, *(&TNew + stepsize[0]), nX, nY, nZ,
-                                                        cell_v);
-  }
-  if (isEqual(meshPtr[1].deltas[coords[1]], 0.0)) {
-    Qm = cell_v[index - stepsize[1]]->calculateHeatFlux(ndims, *(&TNew - stepsize[1]), nX, nY, nZ,
-                                                        cell_v);
-    Qp = cell_v[index + stepsize[1]]->calculateHeatFlux(ndims, *(&TNew + stepsize[1]), nX, nY, nZ,
-                                                        cell_v);
-  }
-  if (isEqual(meshPtr[2].deltas[coords[2]], 0.0)) {
-    Qm = cell_v[index - stepsize[2]]->calculateHeatFlux(ndims, *(&TNew - stepsize[2]), nX, nY, nZ,
-                                                        cell_v);
-    Qp = cell_v[index + stepsize[2]]->calculateHeatFlux(ndims, *(&TNew + stepsize[2]), nX, nY, nZ,
-                                                        cell_v);
+  if (isEqual(meshPtr()[0].deltas[coords[0]], 0.0)) {
+    Qm = cell_v[index - stepsize()[0]]->calculateHeatFlux(ndims, *(&TNew - stepsize()[0]), nX,
+                                                            nY, nZ, cell_v);
+    Qp = cell_v[index + stepsize()[0]]->calculateHeatFlux(ndims, *(&TNew + stepsize()[0]), nX,
+                                                            nY, nZ, cell_v);
+  }
+  if (isEqual(meshPtr()[1].deltas[coords[1]], 0.0)) {
+    Qm = cell_v[index - stepsize()[1]]->calculateHeatFlux(ndims, *(&TNew - stepsize()[1]), nX,
+                                                            nY, nZ, cell_v);
+    Qp = cell_v[index + stepsize()[1]]->calculateHeatFlux(ndims, *(&TNew + stepsize()[1]), nX,
+                                                            nY, nZ, cell_v);
+  }
+  if (isEqual(meshPtr()[2].deltas[coords[2]], 0.0)) {
+    Qm = cell_v[index - stepsize()[2]]->calculateHeatFlux(ndims, *(&TNew - stepsize()[2]), nX,
+                                                            nY, nZ, cell_v);
+    Qp = cell_v[index + stepsize()[2]]->calculateHeatFlux(ndims, *(&TNew + stepsize()[2]), nX,
+                                                            nY, nZ, cell_v);
   }
 
   Qx = (Qm[0] + Qp[0]) * 0.5;
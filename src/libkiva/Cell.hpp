@@ -27,52 +27,118 @@ enum CellType {
   ZERO_THICKNESS // 4
 };
 
-class LIBKIVA_EXPORT Cell {
+// Cells whose temperature is governed by conduction alone
+inline bool isConductionCell(CellType cellType) {
+  return cellType == CellType::NORMAL || cellType == CellType::ZERO_THICKNESS;
+}
+
+// Per-cell data of a domain, stored as one contiguous array per property (structure of arrays).
+// Solver kernels read these arrays directly; Cell objects are views into them.
+class LIBKIVA_EXPORT CellStore {
 public:
-  Cell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-       const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-       const Foundation &foundation, Surface *surfacePtr, Block *blockPtr, Mesher *mesh);
+  void resize(std::size_t num_cells);
+  std::size_t memoryUsage() const;
 
-  virtual ~Cell(){};
+  std::size_t stepsize[3];
+  std::size_t dims[3]; // dimensions used in calculations (5 if not used)
+  int numberOfDimensions;
+  Mesher *mesh;
+  double *told; // solution, n (indexed as the cells)
 
-  std::size_t coords[3], index;
-  std::size_t *stepsize;
-  std::size_t dims[3];
+  // organizational properties
+  std::vector<CellType> cellType;
+  std::vector<Surface *> surfacePtr;
+  std::vector<Block *> blockPtr;
 
   // inherent properties
-  double density;
-  double specificHeat;
-  double conductivity;
-  double iHeatCapacity, iHeatCapacityADI; // used to minimize operations in caclulation loops
-
-  double volume;
-  double area, r;
-  double heatGain;
+  std::vector<double> density;
+  std::vector<double> specificHeat;
+  std::vector<double> conductivity;
+  std::vector<double> iHeatCapacity; // used to minimize operations in caclulation loops
+  std::vector<double> volume;
+  std::vector<double> area;
+  std::vector<double> heatGain;
 
   // derived properties
-  double pde[3][2]{{0}}, pde_c[2]{0};
-  double dist[3][2];
-  double kcoeff[3][2];
-  double *told_ptr;
-  // organizational properties
-
-  CellType cellType;
+  std::vector<double> pde[3][2], pde_c[2];
+  std::vector<double> kcoeff[3][2];
+  std::vector<double> dist[3][2]; // indexed by the cell coordinate along each dimension
+
+  // Kernels for conduction cells (see isConductionCell). They only read the store, so loops over
+  // these cells call them directly rather than through a Cell. C holds the stencil coefficients
+  // from gatherCCoeffs for the cell and timestep. N is the number of dimensions (0 if only known
+  // at run time).
+  template <int N> std::size_t computeDim(std::size_t d) const;
+  template <int N, bool CYLINDRICAL>
+  void gatherCCoeffs(std::size_t index, double theta, double (&C)[3][2]) const;
+  void gatherCCoeffs(std::size_t index, double theta, bool cylindrical, double (&C)[3][2]) const;
+  double thetaADI(std::size_t index, double timestep) const { // because of each sub-timestep
+    return timestep * (iHeatCapacity[index] / numberOfDimensions);
+  }
+  template <int N>
+  void calcCellADEUp(std::size_t index, double timestep, const double (&C)[3][2],
+                     double *U) const;
+  template <int N>
+  void calcCellADEDown(std::size_t index, double timestep, const double (&C)[3][2],
+                       double *V) const;
+  template <int N>
+  double calcCellExplicit(std::size_t index, double timestep, const double (&C)[3][2]) const;
+  template <int N>
+  void calcCellMatrix(std::size_t index, Foundation::NumericalScheme scheme, double timestep,
+                      const double (&C)[3][2], double &A, double (&Alt)[3][2],
+                      double &bVal) const;
+  template <int N, bool CYLINDRICAL>
+  void calcCellSteadyState(std::size_t index, double &A, double (&Alt)[3][2],
+                           double &bVal) const;
+  template <int N>
+  void calcCellADI(std::size_t index, std::size_t dim, double timestep, double fADI,
+                   const double (&C)[3][2], double &A, double (&Alt)[2], double &bVal) const;
+};
 
-  Block *blockPtr;
+// A view of one cell of a CellStore. Since the store replaced per-cell storage, cell properties are
+// accessors (e.g. cellType(), density(), pde(dim, dir), told_ptr()) rather than public fields. Each
+// view shares ownership of its store, so a cell may outlive the Domain it was taken from.
+class LIBKIVA_EXPORT Cell {
+public:
+  Cell(const std::size_t &index, const CellType cellType, const std::size_t &i,
+       const std::size_t &j, const std::size_t &k, const std::shared_ptr<CellStore> &store,
+       const Foundation &foundation, Surface *surfacePtr, Block *blockPtr);
 
-  Surface *surfacePtr;
-  Mesher *meshPtr;
+  virtual ~Cell(){};
 
-  void setDistances(const double &dxp_in, const double &dxm_in, const double &dyp_in,
-                    const double &dym_in, const double &dzp_in, const double &dzm_in);
+  CellIndex coords[3], index;
+  std::shared_ptr<CellStore> store;
+
+  // Views of the cell's data in the store
+  const std::size_t (&stepsize() const)[3] { return store->stepsize; }
+  const std::size_t (&dims() const)[3] { return store->dims; }
+  Mesher *meshPtr() const { return store->mesh; }
+  double *told_ptr() const { return store->told + index; }
+
+  CellType cellType() const { return store->cellType[index]; }
+  Surface *surfacePtr() const { return store->surfacePtr[index]; }
+  Block *blockPtr() const { return store->blockPtr[index]; }
+
+  double &density() { return store->density[index]; }
+  double &specificHeat() { return store->specificHeat[index]; }
+  double &conductivity() { return store->conductivity[index]; }
+  double &iHeatCapacity() { return store->iHeatCapacity[index]; }
+  double &volume() { return store->volume[index]; }
+  double &area() { return store->area[index]; }
+  double &heatGain() { return store->heatGain[index]; }
+
+  double &pde(std::size_t dim, std::size_t dir) { return store->pde[dim][dir][index]; }
+  double &pde_c(std::size_t dir) { return store->pde_c[dir][index]; }
+  double &kcoeff(std::size_t dim, std::size_t dir) { return store->kcoeff[dim][dir][index]; }
+  double dist(std::size_t dim, std::size_t dir) const {
+    return store->dist[dim][dir][coords[dim]];
+  }
 
   void setConductivities(const std::vector<std::shared_ptr<Cell>> &cell_v);
 
   void setPDEcoefficients(int ndims, bool cylindrical);
   double onePDEcoefficient(std::size_t dim, std::size_t dir);
 
-  void setComputeDims(std::size_t (&dims)[3]);
-
   void setZeroThicknessCellProperties(std::vector<std::shared_ptr<Cell>> pointSet);
 
   virtual void calcCellADEUp(double timestep, const Foundation &foundation,
@@ -103,17 +169,14 @@ public:
 
   inline void doOutdoorTemp(const BoundaryConditions &bcs, double &A, double &bVal);
   inline void doIndoorTemp(const BoundaryConditions &bcs, double &A, double &bVal);
-
-  void ADImath(std::size_t dim, const double Q, const double f, const double multiplier,
-               const double (&C)[3][2], double &A, double (&Alt)[2], double &bVal);
 };
 
 class ExteriorAirCell : public Cell {
 public:
   ExteriorAirCell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-                  const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-                  const Foundation &foundation, Surface *surfacePtr, Block *blockPtr,
-                  Mesher *meshptr);
+                  const std::size_t &j, const std::size_t &k,
+                  const std::shared_ptr<CellStore> &store, const Foundation &foundation,
+                  Surface *surfacePtr, Block *blockPtr);
 
   void calcCellADEUp(double timestep, const Foundation &foundation, const BoundaryConditions &bcs,
                      double &U) override;
@@ -135,9 +198,9 @@ public:
 class InteriorAirCell : public Cell {
 public:
   InteriorAirCell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-                  const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-                  const Foundation &foundation, Surface *surfacePtr, Block *blockPtr,
-                  Mesher *meshptr);
+                  const std::size_t &j, const std::size_t &k,
+                  const std::shared_ptr<CellStore> &store, const Foundation &foundation,
+                  Surface *surfacePtr, Block *blockPtr);
 
   void calcCellADEUp(double timestep, const Foundation &foundation, const BoundaryConditions &bcs,
                      double &U) override;
@@ -159,8 +222,8 @@ public:
 class BoundaryCell : public Cell {
 public:
   BoundaryCell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-               const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-               const Foundation &foundation, Surface *surfacePtr, Block *blockPtr, Mesher *meshptr);
+               const std::size_t &j, const std::size_t &k, const std::shared_ptr<CellStore> &store,
+               const Foundation &foundation, Surface *surfacePtr, Block *blockPtr);
 
   void calcCellADEUp(double timestep, const Foundation &foundation, const BoundaryConditions &bcs,
                      double &U) override;
@@ -200,15 +263,183 @@ private:
 class ZeroThicknessCell : public Cell {
 public:
   ZeroThicknessCell(const std::size_t &index, const CellType cellType, const std::size_t &i,
-                    const std::size_t &j, const std::size_t &k, std::size_t *stepsize,
-                    const Foundation &foundation, Surface *surfacePtr, Block *blockPtr,
-                    Mesher *meshptr);
+                    const std::size_t &j, const std::size_t &k,
+                    const std::shared_ptr<CellStore> &store, const Foundation &foundation,
+                    Surface *surfacePtr, Block *blockPtr);
 
   std::vector<double> calculateHeatFlux(int ndims, double &TNew, std::size_t nX, std::size_t nY,
                                         std::size_t nZ,
                                         const std::vector<std::shared_ptr<Cell>> &cell_v) override;
 };
 
+// Conduction kernels. N is the number of dimensions of the domain, or 0 to read the computed
+// dimensions from `dims` at run time. With N known at compile time, the loops over directions
+// unroll and the checks for dimensions that are not computed fold away.
+
+template <int N> inline std::size_t CellStore::computeDim(std::size_t d) const {
+  return N == 0 ? dims[d] : N == 1 ? 2 : N == 2 ? 2 * d : d;
+}
+
+template <int N, bool CYLINDRICAL>
+void CellStore::gatherCCoeffs(std::size_t index, double theta, double (&C)[3][2]) const {
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      C[dim][0] = pde[dim][0][index] * theta;
+      C[dim][1] = pde[dim][1][index] * theta;
+    }
+  }
+  if (CYLINDRICAL && N != 1) {
+    const std::size_t i = index % stepsize[1];
+    if (i != 0) {
+      const double r = mesh[0].centers[i];
+      C[0][0] += pde_c[0][index] * theta / r;
+      C[0][1] += pde_c[1][index] * theta / r;
+    }
+  }
+}
+
+template <int N>
+void CellStore::calcCellADEUp(std::size_t index, double timestep, const double (&C)[3][2],
+                              double *U) const {
+  double theta = timestep * iHeatCapacity[index];
+
+  double bit{1}, divisor{1};
+  double u = heatGain[index] * theta;
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      bit -= C[dim][1];
+      divisor -= C[dim][0];
+      u += told[index + stepsize[dim]] * C[dim][1] - U[index - stepsize[dim]] * C[dim][0];
+    }
+  }
+  U[index] = (told[index] * bit + u) / divisor;
+}
+
+template <int N>
+void CellStore::calcCellADEDown(std::size_t index, double timestep, const double (&C)[3][2],
+                                double *V) const {
+  double theta = timestep * iHeatCapacity[index];
+
+  double bit{1}, divisor{1};
+  double v = heatGain[index] * theta;
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      bit += C[dim][0];
+      divisor += C[dim][1];
+      v += V[index + stepsize[dim]] * C[dim][1] - told[index - stepsize[dim]] * C[dim][0];
+    }
+  }
+  V[index] = (told[index] * bit + v) / divisor;
+}
+
+template <int N>
+double CellStore::calcCellExplicit(std::size_t index, double timestep,
+                                   const double (&C)[3][2]) const {
+  double theta = timestep * iHeatCapacity[index];
+
+  double bit{1};
+  double TNew = heatGain[index] * theta;
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      bit += C[dim][0] - C[dim][1];
+      TNew += told[index + stepsize[dim]] * C[dim][1] - told[index - stepsize[dim]] * C[dim][0];
+    }
+  }
+  TNew += told[index] * bit;
+  return TNew;
+}
+
+template <int N>
+void CellStore::calcCellMatrix(std::size_t index, Foundation::NumericalScheme scheme,
+                               double timestep, const double (&C)[3][2], double &A,
+                               double (&Alt)[3][2], double &bVal) const {
+  double theta = timestep * iHeatCapacity[index];
+
+  double f = scheme == Foundation::NS_IMPLICIT ? 1.0 : 0.5;
+
+  double bit{0};
+  bVal = heatGain[index] * theta;
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      bit += C[dim][1] - C[dim][0];
+      Alt[dim][1] = -f * C[dim][1];
+      Alt[dim][0] = f * C[dim][0];
+      bVal += told[index + stepsize[dim]] * (1 - f) * C[dim][1] -
+              told[index - stepsize[dim]] * (1 - f) * C[dim][0];
+    }
+  }
+  A = (1.0 + f * bit);
+  bVal += told[index] * (1.0 - (1 - f) * bit);
+}
+
+template <int N, bool CYLINDRICAL>
+void CellStore::calcCellSteadyState(std::size_t index, double &A, double (&Alt)[3][2],
+                                    double &bVal) const {
+  A = 0;
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t dim = computeDim<N>(d);
+    if (dim < 5) {
+      Alt[dim][1] = pde[dim][1][index];
+      Alt[dim][0] = -pde[dim][0][index];
+      A += Alt[dim][1] + Alt[dim][0];
+    }
+  }
+  if (CYLINDRICAL && N != 1) {
+    const std::size_t i = index % stepsize[1];
+    if (i != 0) {
+      const double r = mesh[0].centers[i];
+      Alt[0][1] += pde_c[1][index] / r;
+      Alt[0][0] += -pde_c[0][index] / r;
+      A += pde_c[1][index] / r - pde_c[0][index] / r;
+    }
+  }
+  A *= -1;
+  bVal = -heatGain[index];
+}
+
+template <int N>
+void CellStore::calcCellADI(std::size_t index, std::size_t dim, double timestep, double fADI,
+                            const double (&C)[3][2], double &A, double (&Alt)[2],
+                            double &bVal) const {
+  double theta = thetaADI(index, timestep);
+
+  double Q = heatGain[index] * theta;
+
+  if (N == 1 || (N == 0 && numberOfDimensions == 1)) {
+    A = 1.0 + (pde[2][1][index] - pde[2][0][index]) * theta;
+    Alt[0] = pde[2][0][index] * theta;
+    Alt[1] = -pde[2][1][index] * theta;
+
+    bVal = told[index] + Q;
+    return;
+  }
+
+  const int ndims = N == 0 ? numberOfDimensions : N;
+  double f = fADI;
+  double multiplier = ndims == 2 ? (2.0 - f) : (3.0 - 2.0 * f);
+
+  bVal = Q;
+  double bit{0};
+  for (std::size_t d = 0; d < (N == 0 ? 3 : N); d++) {
+    const std::size_t sdim = computeDim<N>(d);
+    if (sdim == dim) {
+      Alt[0] = multiplier * C[sdim][0];
+      Alt[1] = -multiplier * C[sdim][1];
+      A = 1.0 - (Alt[0] + Alt[1]);
+    } else if (sdim < 5) {
+      bit += C[sdim][0] - C[sdim][1];
+      bVal += told[index + stepsize[sdim]] * f * C[sdim][1] -
+              told[index - stepsize[sdim]] * f * C[sdim][0];
+    }
+  }
+  bVal += told[index] * (1.0 + f * bit);
+}
+
 } // namespace Kiva
 
 #endif
@@ -28,36 +28,45 @@ void Domain::setDomain(Foundation &foundation) {
     dim_lengths[dim] = mesh[dim].centers.size();
   }
 
-  std::vector<double> dxp_vector, dxm_vector, dyp_vector, dym_vector, dzp_vector, dzm_vector;
-  for (std::size_t i = 0; i < dim_lengths[0]; i++) {
-    dxp_vector.emplace_back(getDistances(i, 0, 1));
-    dxm_vector.emplace_back(getDistances(i, 0, 0));
-  }
-  for (std::size_t j = 0; j < dim_lengths[1]; j++) {
-    dyp_vector.emplace_back(getDistances(j, 1, 1));
-    dym_vector.emplace_back(getDistances(j, 1, 0));
-  }
-  for (std::size_t k = 0; k < dim_lengths[2]; k++) {
-    dzp_vector.emplace_back(getDistances(k, 2, 1));
-    dzm_vector.emplace_back(getDistances(k, 2, 0));
-  }
-
   stepsize[0] = 1;
   stepsize[1] = dim_lengths[0];
   stepsize[2] = dim_lengths[0] * dim_lengths[1];
   std::size_t num_cells = dim_lengths[0] * dim_lengths[1] * dim_lengths[2];
+  if (num_cells >= std::numeric_limits<CellIndex>::max()) {
+    showMessage(MSG_ERR, "The domain has too many cells for 32-bit cell indices. Build Kiva with "
+                         "KIVA_64BIT_INDEX.");
+  }
+
+  cellStore = std::make_shared<CellStore>();
+  CellStore *store = cellStore.get();
+  store->resize(num_cells);
+  store->mesh = mesh;
+  store->told = nullptr;
+  store->numberOfDimensions = foundation.numberOfDimensions;
+  for (std::size_t dim = 0; dim < 3; ++dim) {
+    store->stepsize[dim] = stepsize[dim];
+    store->dims[dim] = dim;
+    for (std::size_t dir = 0; dir < 2; ++dir) {
+      store->dist[dim][dir].resize(dim_lengths[dim]);
+      for (std::size_t i = 0; i < dim_lengths[dim]; i++) {
+        store->dist[dim][dir][i] = getDistances(i, dim, dir);
+      }
+    }
+  }
+  if (foundation.numberOfDimensions < 3) {
+    store->dims[1] = 5;
+  }
+  if (foundation.numberOfDimensions == 1) {
+    store->dims[0] = 5;
+  }
+
+  cell.clear();
   cell.reserve(num_cells);
-  dest_index_vector.resize(3, std::vector<std::size_t>(num_cells));
-  std::vector<std::size_t> temp_di(3);
   std::size_t i, j, k;
   CellType cellType;
 
   for (std::size_t index = 0; index < num_cells; index++) {
     std::tie(i, j, k) = getCoordinates(index);
-    temp_di = getDestIndex(i, j, k);
-    for (std::size_t d = 0; d < 3; d++) {
-      dest_index_vector[d][index] = temp_di[d];
-    }
 
     cellType = CellType::NORMAL;
     Surface *surfacePtr;
@@ -114,11 +123,11 @@ void Domain::setDomain(Foundation &foundation) {
     // double-instantiation.
     if (cellType == CellType::ZERO_THICKNESS) {
       std::shared_ptr<ZeroThicknessCell> sp = std::make_shared<ZeroThicknessCell>(
-          index, cellType, i, j, k, stepsize, foundation, surfacePtr, nullptr, mesh);
+          index, cellType, i, j, k, cellStore, foundation, surfacePtr, nullptr);
       cell.emplace_back(std::move(sp));
     } else if (cellType == CellType::BOUNDARY) {
       std::shared_ptr<BoundaryCell> sp = std::make_shared<BoundaryCell>(
-          index, cellType, i, j, k, stepsize, foundation, surfacePtr, nullptr, mesh);
+          index, cellType, i, j, k, cellStore, foundation, surfacePtr, nullptr);
       cell.emplace_back(std::move(sp));
     } else { // if (cellType == CellType::NORMAL)
       Block *blockPtr = nullptr;
@@ -134,16 +143,16 @@ void Domain::setDomain(Foundation &foundation) {
         if (blockPtr->blockType == Block::INTERIOR_AIR) {
           cellType = CellType::INTERIOR_AIR;
           std::shared_ptr<InteriorAirCell> sp = std::make_shared<InteriorAirCell>(
-              index, cellType, i, j, k, stepsize, foundation, nullptr, blockPtr, mesh);
+              index, cellType, i, j, k, cellStore, foundation, nullptr, blockPtr);
           cell.emplace_back(std::move(sp));
         } else if (blockPtr->blockType == Block::EXTERIOR_AIR) {
           cellType = CellType::EXTERIOR_AIR;
           std::shared_ptr<ExteriorAirCell> sp = std::make_shared<ExteriorAirCell>(
-              index, cellType, i, j, k, stepsize, foundation, nullptr, blockPtr, mesh);
+              index, cellType, i, j, k, cellStore, foundation, nullptr, blockPtr);
           cell.emplace_back(std::move(sp));
         } else {
-          std::shared_ptr<Cell> sp = std::make_shared<Cell>(index, cellType, i, j, k, stepsize,
-                                                            foundation, nullptr, blockPtr, mesh);
+          std::shared_ptr<Cell> sp = std::make_shared<Cell>(index, cellType, i, j, k, cellStore,
+                                                            foundation, nullptr, blockPtr);
           cell.emplace_back(std::move(sp));
         }
       } else {
@@ -165,11 +174,11 @@ void Domain::setDomain(Foundation &foundation) {
 
         if (cellType == CellType::ZERO_THICKNESS) {
           std::shared_ptr<ZeroThicknessCell> sp = std::make_shared<ZeroThicknessCell>(
-              index, cellType, i, j, k, stepsize, foundation, nullptr, nullptr, mesh);
+              index, cellType, i, j, k, cellStore, foundation, nullptr, nullptr);
           cell.emplace_back(std::move(sp));
         } else {
-          std::shared_ptr<Cell> sp = std::make_shared<Cell>(index, cellType, i, j, k, stepsize,
-                                                            foundation, nullptr, nullptr, mesh);
+          std::shared_ptr<Cell> sp = std::make_shared<Cell>(index, cellType, i, j, k, cellStore,
+                                                            foundation, nullptr, nullptr);
           cell.emplace_back(std::move(sp));
         }
       }
@@ -178,14 +187,14 @@ void Domain::setDomain(Foundation &foundation) {
 
   // Set effective properties of zero-thickness cells
   // based on other cells
-  for (auto this_cell : cell) {
+  for (const auto &this_cell : cell) {
     std::size_t index = this_cell->index;
     std::tie(i, j, k) = getCoordinates(index);
 
     int numZeroDims = getNumZeroDims(i, j, k);
 
-    if (numZeroDims > 0 && this_cell->cellType != CellType::INTERIOR_AIR &&
-        this_cell->cellType != CellType::EXTERIOR_AIR) {
+    if (numZeroDims > 0 && this_cell->cellType() != CellType::INTERIOR_AIR &&
+        this_cell->cellType() != CellType::EXTERIOR_AIR) {
       if (foundation.numberOfDimensions == 3) {
         if (i != 0 && i != dim_lengths[0] - 1 && j != 0 && j != dim_lengths[1] - 1 && k != 0 &&
             k != dim_lengths[2] - 1)
@@ -206,21 +215,9 @@ void Domain::setDomain(Foundation &foundation) {
     }
   }
 
-  std::size_t dims[3]{0, 1, 2};
-  if (foundation.numberOfDimensions < 3) {
-    dims[1] = 5;
-  }
-  if (foundation.numberOfDimensions == 1) {
-    dims[0] = 5;
-  }
-
   // Calculate matrix coefficients
-  for (auto this_cell : cell) {
+  for (const auto &this_cell : cell) {
     // PDE Coefficients
-    this_cell->setComputeDims(dims);
-    this_cell->setDistances(dxp_vector[this_cell->coords[0]], dxm_vector[this_cell->coords[0]],
-                            dyp_vector[this_cell->coords[1]], dym_vector[this_cell->coords[1]],
-                            dzp_vector[this_cell->coords[2]], dzm_vector[this_cell->coords[2]]);
     this_cell->setConductivities(cell);
     this_cell->setPDEcoefficients(foundation.numberOfDimensions,
                                   foundation.coordinateSystem == Foundation::CS_CYLINDRICAL);
@@ -237,12 +234,106 @@ void Domain::setDomain(Foundation &foundation) {
   for (auto &surface : foundation.surfaces) {
     surface.calcTilt();
     surface.area = 0;
-    for (auto index : surface.indices) {
-      surface.area += cell[index]->area;
+    surface.cellAreas.resize(surface.indices.size());
+    for (std::size_t c = 0; c < surface.indices.size(); c++) {
+      surface.cellAreas[c] = store->area[surface.indices[c]];
+      surface.area += surface.cellAreas[c];
+    }
+    surface.cellAbsorptivities.clear();
+    if (surface.type == Surface::ST_GRADE || surface.type == Surface::ST_WALL_EXT) {
+      // Properties of the surface each cell belongs to (the last one assigned, where surfaces meet)
+      for (auto index : surface.indices) {
+        surface.cellAbsorptivities.push_back(store->surfacePtr[index]->propPtr->absorptivity);
+      }
     }
     std::tie(surface.orientation_dim, surface.orientation_dir, surface.azimuth) =
         orientation_map[surface.orientation];
   }
+
+  buildCellPartitions();
+  buildActiveCells();
+}
+
+void Domain::buildCellPartitions() {
+  std::map<std::tuple<CellType, Surface::BoundaryConditionType, Surface::Orientation>,
+           std::size_t>
+      partitionIndex;
+  cellPartitions.clear();
+  for (std::size_t index = 0; index < cell.size(); index++) {
+    CellPartition key;
+    key.cellType = cellStore->cellType[index];
+    key.boundaryConditionType = Surface::ZERO_FLUX;
+    key.orientation = Surface::X_POS;
+    if (key.cellType == CellType::BOUNDARY) {
+      key.boundaryConditionType = cellStore->surfacePtr[index]->boundaryConditionType;
+      key.orientation = cellStore->surfacePtr[index]->orientation;
+    }
+    auto inserted = partitionIndex.emplace(
+        std::make_tuple(key.cellType, key.boundaryConditionType, key.orientation),
+        cellPartitions.size());
+    if (inserted.second) {
+      cellPartitions.push_back(key);
+    }
+    cellPartitions[inserted.first->second].indices.push_back(index);
+  }
+
+  // NORMAL cells, most of the domain, come first
+  std::sort(cellPartitions.begin(), cellPartitions.end(),
+            [](const CellPartition &a, const CellPartition &b) {
+              return std::make_tuple(a.cellType != CellType::NORMAL, a.cellType,
+                                     a.boundaryConditionType, a.orientation) <
+                     std::make_tuple(b.cellType != CellType::NORMAL, b.cellType,
+                                     b.boundaryConditionType, b.orientation);
+            });
+}
+
+void Domain::buildActiveCells() {
+  activeIndex.assign(cell.size(), 0);
+  for (const auto &partition : cellPartitions) {
+    if (partition.isFixedTemperature()) {
+      for (auto index : partition.indices) {
+        activeIndex[index] = INACTIVE_CELL;
+      }
+    }
+  }
+
+  activeCells.clear();
+  for (std::size_t index = 0; index < cell.size(); index++) {
+    if (activeIndex[index] != INACTIVE_CELL) {
+      activeIndex[index] = static_cast<CellIndex>(activeCells.size());
+      activeCells.push_back(index);
+    }
+  }
+}
+
+MemoryReport Domain::memoryReport() const {
+  MemoryReport report;
+
+  // Each cell view is a single allocation (by make_shared) of the view and its shared_ptr control
+  // block (a vtable pointer and the use and weak counts). Allocator overhead is not counted.
+  static_assert(sizeof(ExteriorAirCell) == sizeof(Cell) &&
+                    sizeof(InteriorAirCell) == sizeof(Cell) &&
+                    sizeof(BoundaryCell) == sizeof(Cell) &&
+                    sizeof(ZeroThicknessCell) == sizeof(Cell),
+                "Cell views are counted at the size of Cell");
+  const std::size_t controlBlockBytes = sizeof(void *) + 2 * sizeof(long);
+  std::size_t cellBytes =
+      Kiva::memoryUsage(cell) + cell.size() * (sizeof(Cell) + controlBlockBytes);
+  if (cellStore) {
+    cellBytes += cellStore->memoryUsage();
+  }
+  report.add("Cells", cellBytes);
+
+  report.add("Mesh", mesh[0].memoryUsage() + mesh[1].memoryUsage() + mesh[2].memoryUsage());
+
+  std::size_t partitionBytes = Kiva::memoryUsage(cellPartitions) +
+                               Kiva::memoryUsage(activeCells) + Kiva::memoryUsage(activeIndex);
+  for (const auto &partition : cellPartitions) {
+    partitionBytes += Kiva::memoryUsage(partition.indices);
+  }
+  report.add("Cell partitions", partitionBytes);
+
+  return report;
 }
 
 double Domain::getDistances(std::size_t i, std::size_t dim, std::size_t dir) {
@@ -373,7 +464,7 @@ void Domain::printCellTypes() {
 
       output << ", ";
 
-      output << cell[i + (dim_lengths[1] / 2) * stepsize[1] + k * stepsize[2]]->cellType;
+      output << cell[i + (dim_lengths[1] / 2) * stepsize[1] + k * stepsize[2]]->cellType();
 
       //      output << cell[i + (dim_lengths[1]/2)*stepsize[1] + k*stepsize[2]]->pde[2][0];
 
@@ -398,14 +489,6 @@ std::tuple<std::size_t, std::size_t, std::size_t> Domain::getCoordinates(std::si
   return std::make_tuple(i, j, k);
 }
 
-std::vector<std::size_t> Domain::getDestIndex(std::size_t i, std::size_t j, std::size_t k) {
-  std::vector<std::size_t> dest_index;
-  dest_index.emplace_back(i + dim_lengths[0] * j + dim_lengths[0] * dim_lengths[1] * k);
-  dest_index.emplace_back(j + dim_lengths[1] * i + dim_lengths[1] * dim_lengths[0] * k);
-  dest_index.emplace_back(k + dim_lengths[2] * i + dim_lengths[2] * dim_lengths[0] * j);
-  return dest_index;
-}
-
 } // namespace Kiva
 
 #endif
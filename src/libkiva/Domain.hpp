@@ -8,15 +8,40 @@
 #include "Errors.hpp"
 #include "Foundation.hpp"
 #include "Functions.hpp"
+#include "MemoryReport.hpp"
 #include "Mesher.hpp"
 #include "libkiva_export.h"
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <numeric>
 
 namespace Kiva {
 
+static const CellIndex INACTIVE_CELL = std::numeric_limits<CellIndex>::max();
+
+// Cells of one type and, for boundary cells, one boundary condition type and orientation. Schemes
+// loop over each partition with a single kernel instead of dispatching cell by cell.
+struct CellPartition {
+  CellType cellType;
+  Surface::BoundaryConditionType boundaryConditionType;
+  Surface::Orientation orientation;
+  std::vector<CellIndex> indices; // in ascending order
+
+  bool isConduction() const { return isConductionCell(cellType); }
+
+  // Cells whose temperature is set directly by the boundary conditions
+  bool isFixedTemperature() const {
+    return cellType == CellType::EXTERIOR_AIR || cellType == CellType::INTERIOR_AIR ||
+           (cellType == CellType::BOUNDARY &&
+            (boundaryConditionType == Surface::CONSTANT_TEMPERATURE ||
+             boundaryConditionType == Surface::INTERIOR_TEMPERATURE ||
+             boundaryConditionType == Surface::EXTERIOR_TEMPERATURE));
+  }
+};
+
 class LIBKIVA_EXPORT Domain {
 public:
   // mesh
@@ -24,8 +49,14 @@ public:
   std::size_t dim_lengths[3];
   std::size_t stepsize[3];
 
-  std::vector<std::shared_ptr<Cell>> cell;
-  std::vector<std::vector<std::size_t>> dest_index_vector;
+  std::shared_ptr<CellStore> cellStore;
+  std::vector<std::shared_ptr<Cell>> cell; // views of the cells in cellStore
+  std::vector<CellPartition> cellPartitions;
+
+  // Cells that are solved for (not fixed temperature), in ascending order, and the position of
+  // each cell among them (INACTIVE_CELL for fixed-temperature cells)
+  std::vector<CellIndex> activeCells;
+  std::vector<CellIndex> activeIndex;
 
 public:
   Domain();
@@ -35,9 +66,11 @@ public:
   double getDistances(std::size_t i, std::size_t dim, std::size_t dir);
   void set2DZeroThicknessCellProperties(std::size_t index);
   void set3DZeroThicknessCellProperties(std::size_t index);
+  void buildCellPartitions();
+  void buildActiveCells();
+  MemoryReport memoryReport() const; // cells, mesh and cell partitions
   void printCellTypes();
   std::tuple<std::size_t, std::size_t, std::size_t> getCoordinates(std::size_t index);
-  std::vector<std::size_t> getDestIndex(std::size_t i, std::size_t j, std::size_t k);
 };
 
 } // namespace Kiva
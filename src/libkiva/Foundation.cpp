@@ -106,7 +106,9 @@ Foundation::Foundation()
       reductionStrategy(RS_BOUNDARY), exposedFraction(1.0), useDetailedExposedPerimeter(false),
       buildingHeight(0.0), hasWall(true), hasSlab(true), perimeterSurfaceWidth(0.0),
       hasPerimeterSurface(false), mesh(Mesh()), numericalScheme(NS_ADI), fADI(0.00001),
-      tolerance(1.0e-6), maxIterations(100000) {}
+      tolerance(1.0e-6), maxIterations(100000), linearSolver(LS_BICGSTAB_ILUT),
+      preconditionerRefreshInterval(0), preconditionerIterationGrowth(0.0),
+      adaptiveTimestepTolerance(0.1) {}
 
 void Foundation::createMeshData() {
   std::size_t nV = polygon.outer().size();
@@ -600,17 +602,7 @@ void Foundation::createMeshData() {
   yMax = yMaxBB + farFieldWidth;
 
   // Initialize to zero
-  surfaceAreas[Surface::ST_FAR_FIELD_AIR] = 0.0;
-  surfaceAreas[Surface::ST_FAR_FIELD] = 0.0;
-  surfaceAreas[Surface::ST_DEEP_GROUND] = 0.0;
-  surfaceAreas[Surface::ST_SLAB_CORE] = 0.0;
-  surfaceAreas[Surface::ST_GRADE] = 0.0;
-  surfaceAreas[Surface::ST_TOP_AIR_INT] = 0.0;
-  surfaceAreas[Surface::ST_TOP_AIR_EXT] = 0.0;
-  surfaceAreas[Surface::ST_WALL_TOP] = 0.0;
-  surfaceAreas[Surface::ST_SLAB_PERIM] = 0.0;
-  surfaceAreas[Surface::ST_WALL_INT] = 0.0;
-  surfaceAreas[Surface::ST_WALL_EXT] = 0.0;
+  surfaceAreas.fill(0.0);
 
   // Add surface-by-surface
   if (isGreaterThan(zMax, 0.0)) {
@@ -710,8 +702,9 @@ void Foundation::createMeshData() {
     }
   }
 
-  for (auto &s : surfaceAreas) {
-    hasSurface[s.first] = s.second > 0.0;
+  for (std::size_t s = 0; s < Surface::NUM_SURFACE_TYPES; s++) {
+    Surface::SurfaceType type = static_cast<Surface::SurfaceType>(s);
+    hasSurface[type] = surfaceAreas[type] > 0.0;
   }
 
   double area = boost::geometry::area(polygon);           // [m2] Area of foundation
@@ -9,6 +9,11 @@
 #include "Geometry.hpp"
 #include "Mesher.hpp"
 
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 namespace Kiva {
 
 class LIBKIVA_EXPORT Material {
@@ -107,6 +112,7 @@ public:
     ST_TOP_AIR_INT,
     ST_TOP_AIR_EXT
   };
+  static const std::size_t NUM_SURFACE_TYPES = ST_TOP_AIR_EXT + 1;
 
   Polygon polygon;
   double xMin, xMax, yMin, yMax, zMin, zMax;
@@ -127,7 +133,10 @@ public:
   Orientation orientation;
   std::size_t orientation_dim, orientation_dir;
 
-  std::vector<std::size_t> indices;
+  // Boundary cells of the surface, packed for the surface loops of each timestep (set by Domain)
+  std::vector<CellIndex> indices;         // in ascending order
+  std::vector<double> cellAreas;          // [m2] area of each cell in indices
+  std::vector<double> cellAbsorptivities; // of each cell (grade and exterior wall surfaces only)
 
   // Geometry
   double area, tilt, azimuth, cosTilt;
@@ -161,6 +170,102 @@ public:
   bool isType(double position, RangeType::Type type);
 };
 
+// Iterator over the elements of a fixed-size array indexed by enums, for code written for the
+// std::map iterators it replaced. Elements are (key, reference to value) pairs made on access,
+// so they are not references into the container: loop with `const auto &` or `auto &&`. The
+// values can still be assigned through `second`.
+template <typename Container, typename Value> class KeyedArrayIterator {
+public:
+  typedef typename std::remove_const<Container>::type::key_type Key;
+  typedef std::pair<const Key, Value &> value_type;
+  typedef value_type reference;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::input_iterator_tag iterator_category;
+  class pointer {
+  public:
+    explicit pointer(const value_type &element) : element(element) {}
+    const value_type *operator->() const { return &element; }
+
+  private:
+    value_type element;
+  };
+
+  KeyedArrayIterator(Container *container, std::size_t position)
+      : container(container), position(position) {}
+
+  reference operator*() const {
+    return value_type(container->keyAt(position), container->valueAt(position));
+  }
+  pointer operator->() const { return pointer(**this); }
+
+  KeyedArrayIterator &operator++() {
+    ++position;
+    return *this;
+  }
+  KeyedArrayIterator operator++(int) {
+    KeyedArrayIterator previous = *this;
+    ++position;
+    return previous;
+  }
+
+  bool operator==(const KeyedArrayIterator &other) const { return position == other.position; }
+  bool operator!=(const KeyedArrayIterator &other) const { return position != other.position; }
+
+private:
+  Container *container;
+  std::size_t position;
+};
+
+// A value for each surface type, stored in a fixed-size array indexed by the type. Subscripting,
+// at, count, find and iteration (in key order) work as they did for the std::map this replaced,
+// except that every type is always present.
+template <typename T> class SurfaceTypeArray {
+public:
+  typedef Surface::SurfaceType key_type;
+  typedef T mapped_type;
+  typedef KeyedArrayIterator<SurfaceTypeArray, T> iterator;
+  typedef KeyedArrayIterator<const SurfaceTypeArray, const T> const_iterator;
+
+  SurfaceTypeArray() { values.fill(T()); }
+
+  T &operator[](Surface::SurfaceType type) { return values[type]; }
+  const T &operator[](Surface::SurfaceType type) const { return values[type]; }
+
+  // Throw std::out_of_range for values outside of the enum
+  T &at(Surface::SurfaceType type) { return values.at(type); }
+  const T &at(Surface::SurfaceType type) const { return values.at(type); }
+
+  std::size_t count(Surface::SurfaceType type) const {
+    return static_cast<std::size_t>(type) < values.size() ? 1 : 0;
+  }
+
+  iterator find(Surface::SurfaceType type) { return iterator(this, position(type)); }
+  const_iterator find(Surface::SurfaceType type) const {
+    return const_iterator(this, position(type));
+  }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, values.size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, values.size()); }
+
+  std::size_t size() const { return values.size(); }
+
+  void fill(const T &value) { values.fill(value); }
+
+private:
+  template <typename, typename> friend class KeyedArrayIterator;
+
+  std::size_t position(Surface::SurfaceType type) const {
+    return count(type) ? static_cast<std::size_t>(type) : values.size();
+  }
+  static key_type keyAt(std::size_t position) { return static_cast<key_type>(position); }
+  T &valueAt(std::size_t position) { return values[position]; }
+  const T &valueAt(std::size_t position) const { return values[position]; }
+
+  std::array<T, Surface::NUM_SURFACE_TYPES> values;
+};
+
 class LIBKIVA_EXPORT Foundation {
 public:
   Foundation();
@@ -243,6 +348,29 @@ public:
   double tolerance;
   int maxIterations;
 
+  enum LinearSolverType {
+    LS_BICGSTAB_ILUT,
+    LS_BICGSTAB_JACOBI,
+    LS_GMRES_ILUT,
+    LS_SPARSE_LU,
+    LS_BICGSTAB_MATRIX_FREE,
+    LS_BICGSTAB_MULTIGRID
+  };
+
+  LinearSolverType linearSolver;
+
+  // Preconditioner reuse for iterative matrix solutions. By default the preconditioner is rebuilt
+  // only when the assembled matrix changes. If either limit is set, a preconditioner built for an
+  // earlier matrix is reused until it has been used for `preconditionerRefreshInterval` solutions
+  // or the iteration count grows beyond `preconditionerIterationGrowth` times the count of the
+  // first solution with that preconditioner (0 disables a limit).
+  int preconditionerRefreshInterval;
+  double preconditionerIterationGrowth;
+
+  // Largest difference in the average heat flux of the output surfaces, [W/m2], between a step
+  // and two half steps accepted by Ground::calculateAdaptive
+  double adaptiveTimestepTolerance;
+
   // Derived variables
   MeshData xMeshData;
   MeshData yMeshData;
@@ -250,8 +378,8 @@ public:
   std::vector<Block> blocks;
   std::vector<Surface> surfaces;
 
-  std::map<Surface::SurfaceType, double> surfaceAreas;
-  std::map<Surface::SurfaceType, bool> hasSurface;
+  SurfaceTypeArray<double> surfaceAreas;
+  SurfaceTypeArray<bool> hasSurface;
   double netArea;
   double netPerimeter;
 
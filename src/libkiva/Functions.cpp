@@ -6,6 +6,11 @@
 
 #include "Functions.hpp"
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define KIVA_TDM_SIMD
+#include <immintrin.h>
+#endif
+
 namespace Kiva {
 
 bool isLessThan(double first, double second, double epsilon) {
@@ -49,14 +54,12 @@ bool isEven(int N) { return (N % 2 == 0); }
 
 void solveTDM(const std::vector<double> &a1, const std::vector<double> &a2, std::vector<double> &a3,
               std::vector<double> &b, std::vector<double> &x) {
-  std::size_t N = b.size();
-  std::size_t i;
+  solveTDM(&a1[0], &a2[0], &a3[0], &b[0], &x[0], b.size());
+}
 
-  double const *a1_(&a1[0]);
-  double const *a2_(&a2[0]);
-  double *a3_(&a3[0]);
-  double *b_(&b[0]);
-  double *x_(&x[0]);
+void solveTDM(const double *a1_, const double *a2_, double *a3_, double *b_, double *x_,
+              std::size_t N) {
+  std::size_t i;
 
   a3_[0] /= a2_[0];
   b_[0] /= a2_[0];
@@ -71,6 +74,133 @@ void solveTDM(const std::vector<double> &a1, const std::vector<double> &a2, std:
   }
 }
 
+// Thomas algorithm for a single system whose elements are `stride` apart
+static void solveTDMStrided(const double *a1, const double *a2, double *a3, double *b, double *x,
+                            std::size_t N, std::size_t stride) {
+  a3[0] /= a2[0];
+  b[0] /= a2[0];
+
+  for (std::size_t i = 1, p = stride; i < N; ++i, p += stride) {
+    a3[p] /= a2[p] - a1[p] * a3[p - stride];
+    b[p] = (b[p] - a1[p] * b[p - stride]) / (a2[p] - a1[p] * a3[p - stride]);
+  }
+  std::size_t p = (N - 1) * stride;
+  x[p] = b[p];
+  for (std::size_t i = N - 1; i > 0; --i, p -= stride) {
+    x[p - stride] = b[p - stride] - a3[p - stride] * x[p];
+  }
+}
+
+#if defined(KIVA_TDM_SIMD)
+// Vectorized Thomas algorithm: each lane carries one of several adjacent systems through the
+// recurrence in lockstep (4 lanes for AVX2, 8 for AVX-512).
+__attribute__((target("avx2"))) static void
+solveTDMBatchAVX2(const double *a1, const double *a2, double *a3, double *b, double *x,
+                  std::size_t N, std::size_t stride) {
+  __m256d a3Prev = _mm256_div_pd(_mm256_loadu_pd(a3), _mm256_loadu_pd(a2));
+  __m256d bPrev = _mm256_div_pd(_mm256_loadu_pd(b), _mm256_loadu_pd(a2));
+  _mm256_storeu_pd(a3, a3Prev);
+  _mm256_storeu_pd(b, bPrev);
+
+  std::size_t p = stride;
+  for (std::size_t i = 1; i < N; ++i, p += stride) {
+    __m256d lower = _mm256_loadu_pd(a1 + p);
+    __m256d denom = _mm256_sub_pd(_mm256_loadu_pd(a2 + p), _mm256_mul_pd(lower, a3Prev));
+    a3Prev = _mm256_div_pd(_mm256_loadu_pd(a3 + p), denom);
+    __m256d rhs = _mm256_sub_pd(_mm256_loadu_pd(b + p), _mm256_mul_pd(lower, bPrev));
+    bPrev = _mm256_div_pd(rhs, denom);
+    _mm256_storeu_pd(a3 + p, a3Prev);
+    _mm256_storeu_pd(b + p, bPrev);
+  }
+
+  p -= stride;
+  __m256d xNext = bPrev;
+  _mm256_storeu_pd(x + p, xNext);
+  for (std::size_t i = N - 1; i > 0; --i) {
+    p -= stride;
+    xNext = _mm256_sub_pd(_mm256_loadu_pd(b + p), _mm256_mul_pd(_mm256_loadu_pd(a3 + p), xNext));
+    _mm256_storeu_pd(x + p, xNext);
+  }
+}
+
+__attribute__((target("avx512f"))) static void
+solveTDMBatchAVX512(const double *a1, const double *a2, double *a3, double *b, double *x,
+                    std::size_t N, std::size_t stride) {
+  __m512d a3Prev = _mm512_div_pd(_mm512_loadu_pd(a3), _mm512_loadu_pd(a2));
+  __m512d bPrev = _mm512_div_pd(_mm512_loadu_pd(b), _mm512_loadu_pd(a2));
+  _mm512_storeu_pd(a3, a3Prev);
+  _mm512_storeu_pd(b, bPrev);
+
+  std::size_t p = stride;
+  for (std::size_t i = 1; i < N; ++i, p += stride) {
+    __m512d lower = _mm512_loadu_pd(a1 + p);
+    __m512d denom = _mm512_sub_pd(_mm512_loadu_pd(a2 + p), _mm512_mul_pd(lower, a3Prev));
+    a3Prev = _mm512_div_pd(_mm512_loadu_pd(a3 + p), denom);
+    __m512d rhs = _mm512_sub_pd(_mm512_loadu_pd(b + p), _mm512_mul_pd(lower, bPrev));
+    bPrev = _mm512_div_pd(rhs, denom);
+    _mm512_storeu_pd(a3 + p, a3Prev);
+    _mm512_storeu_pd(b + p, bPrev);
+  }
+
+  p -= stride;
+  __m512d xNext = bPrev;
+  _mm512_storeu_pd(x + p, xNext);
+  for (std::size_t i = N - 1; i > 0; --i) {
+    p -= stride;
+    xNext = _mm512_sub_pd(_mm512_loadu_pd(b + p), _mm512_mul_pd(_mm512_loadu_pd(a3 + p), xNext));
+    _mm512_storeu_pd(x + p, xNext);
+  }
+}
+#endif
+
+static std::size_t detectTDMBatchWidth() {
+#if defined(KIVA_TDM_SIMD)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return 8;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return 4;
+  }
+#endif
+  return 1;
+}
+
+std::size_t tdmBatchWidth() {
+  static const std::size_t width = detectTDMBatchWidth();
+  return width;
+}
+
+void solveTDMBatch(const double *a1, const double *a2, double *a3, double *b, double *x,
+                   std::size_t N, std::size_t stride, std::size_t lanes) {
+  std::size_t lane = 0;
+#if defined(KIVA_TDM_SIMD)
+  const std::size_t width = tdmBatchWidth();
+  if (width >= 8) {
+    for (; lane + 8 <= lanes; lane += 8) {
+      solveTDMBatchAVX512(a1 + lane, a2 + lane, a3 + lane, b + lane, x + lane, N, stride);
+    }
+  }
+  if (width >= 4) {
+    for (; lane + 4 <= lanes; lane += 4) {
+      solveTDMBatchAVX2(a1 + lane, a2 + lane, a3 + lane, b + lane, x + lane, N, stride);
+    }
+  }
+#endif
+  // Ragged remainder
+  for (; lane < lanes; ++lane) {
+    solveTDMStrided(a1 + lane, a2 + lane, a3 + lane, b + lane, x + lane, N, stride);
+  }
+}
+
+std::size_t interleavedLineIndex(std::size_t line, std::size_t position, std::size_t lineLength,
+                                 std::size_t numLines) {
+  const std::size_t width = tdmBatchWidth();
+  const std::size_t groupStart = (line / width) * width;
+  const std::size_t groupWidth = std::min(width, numLines - groupStart);
+  return groupStart * lineLength + position * groupWidth + (line - groupStart);
+}
+
 } // namespace Kiva
 
 #endif
@@ -7,6 +7,8 @@
 #include "libkiva_export.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <math.h>
 #include <vector>
@@ -15,6 +17,14 @@ namespace Kiva {
 
 static const double EPSILON = 1E-7;
 
+// Stored cell indices (surface cells, partitions, active cells). No domain approaches 2^32 cells,
+// so they are 32-bit unless built with KIVA_64BIT_INDEX. Index arithmetic still uses std::size_t.
+#ifdef KIVA_64BIT_INDEX
+typedef std::size_t CellIndex;
+#else
+typedef std::uint32_t CellIndex;
+#endif
+
 
 bool LIBKIVA_EXPORT isLessThan(double first, double second, double epsilon=EPSILON);
 bool LIBKIVA_EXPORT isLessOrEqual(double first, double second, double epsilon=EPSILON);
@@ -23,8 +33,27 @@ bool LIBKIVA_EXPORT isGreaterThan(double first, double second, double epsilon=EP
 bool LIBKIVA_EXPORT isGreaterOrEqual(double first, double second, double epsilon=EPSILON);
 bool LIBKIVA_EXPORT isEven(int N);
 bool LIBKIVA_EXPORT isOdd(int N);
-void solveTDM(const std::vector<double> &a1, const std::vector<double> &a2, std::vector<double> &a3,
-              std::vector<double> &b, std::vector<double> &x);
+void LIBKIVA_EXPORT solveTDM(const std::vector<double> &a1, const std::vector<double> &a2,
+                              std::vector<double> &a3, std::vector<double> &b,
+                              std::vector<double> &x);
+void LIBKIVA_EXPORT solveTDM(const double *a1, const double *a2, double *a3, double *b, double *x,
+                             std::size_t N);
+
+// Number of interleaved systems solved together by solveTDMBatch on this CPU (selected at runtime
+// from the available vector instruction sets).
+std::size_t LIBKIVA_EXPORT tdmBatchWidth();
+
+// Solve `lanes` independent tridiagonal systems of length N stored interleaved: element i of
+// system l is at offset i*stride + l. Groups of lanes are vectorized when supported. x may be the
+// same array as b.
+void LIBKIVA_EXPORT solveTDMBatch(const double *a1, const double *a2, double *a3, double *b,
+                                  double *x, std::size_t N, std::size_t stride, std::size_t lanes);
+
+// Position of element `position` of line `line` when contiguous lines of length `lineLength` are
+// interleaved in groups of tdmBatchWidth() lines: each group is stored lane-major (stride equal to
+// the group width) in the place of its lines, so it can be passed to solveTDMBatch.
+std::size_t LIBKIVA_EXPORT interleavedLineIndex(std::size_t line, std::size_t position,
+                                                std::size_t lineLength, std::size_t numLines);
 } // namespace Kiva
 
 #endif
@@ -8,6 +8,9 @@
 
 #include "Ground.hpp"
 #include "Errors.hpp"
+#include "StateIO.hpp"
+
+#include <complex>
 //#include <unsupported/Eigen/SparseExtra>
 
 namespace Kiva {
@@ -16,16 +19,18 @@ static const double PI = 4.0 * atan(1.0);
 
 static const bool TDMA = true;
 
-Ground::Ground(Foundation &foundation) : foundation(foundation) {
-  pSolver = std::make_shared<
-      Eigen::BiCGSTAB<Eigen::SparseMatrix<double>, Eigen::IncompleteLUT<double>>>();
-}
+// Fixed-point passes of the periodic solution over the temperature-dependent surface coefficients
+static const std::size_t PERIODIC_MAX_PASSES = 10;
+static const double PERIODIC_TOLERANCE = 0.01; // largest change in temperature amplitudes, K
+
+// Preconditioners kept for other timesteps of adaptive steps (see selectPreconditioner)
+static const std::size_t PRECONDITIONER_CACHE_SIZE = 3;
+
+Ground::Ground(Foundation &foundation)
+    : foundation(foundation) {}
 
 Ground::Ground(Foundation &foundation, GroundOutput::OutputMap &outputMap)
-    : foundation(foundation), groundOutput(outputMap) {
-  pSolver = std::make_shared<
-      Eigen::BiCGSTAB<Eigen::SparseMatrix<double>, Eigen::IncompleteLUT<double>>>();
-}
+    : foundation(foundation), groundOutput(outputMap) {}
 
 Ground::~Ground() {}
 
@@ -45,6 +50,11 @@ void Ground::buildDomain() {
   if (foundation.numericalScheme == Foundation::NS_ADE) {
     U.resize(num_cells);
     V.resize(num_cells);
+    buildADEBlocks();
+  }
+
+  if (foundation.numericalScheme == Foundation::NS_EXPLICIT) {
+    buildExplicitCoefficients();
   }
 
   if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
@@ -53,173 +63,946 @@ void Ground::buildDomain() {
     a2.resize(num_cells, 0.0);
     a3.resize(num_cells, 0.0);
     b_.resize(num_cells, 0.0);
-    x_.resize(num_cells);
   }
 
-  pSolver->setMaxIterations(foundation.maxIterations);
-  pSolver->setTolerance(foundation.tolerance);
-  tripletList.reserve(num_cells * (1 + 2 * foundation.numberOfDimensions));
-  Amat.resize(num_cells, num_cells);
-  b.resize(num_cells);
-  x.resize(num_cells);
-  x.fill(283.15);
+  matrixFree = foundation.linearSolver == Foundation::LS_BICGSTAB_MATRIX_FREE &&
+               (foundation.numberOfDimensions > 1 || !TDMA);
+  if (matrixFree) {
+    stencil.resize(num_cells, domain.stepsize, domain.dim_lengths);
+    pStencilSolver =
+        std::make_shared<BiCGSTAB<StencilOperator, StencilLinePreconditioner>>();
+    pStencilSolver->setMaxIterations(foundation.maxIterations);
+    pStencilSolver->setTolerance(foundation.tolerance);
+  }
+  releaseSystem();
+  if (assemblesSystem()) {
+    allocateSystem();
+  }
+
+  // Only the ADE and ADI sweeps read the cached coefficients. Matrix assembly gathers them per cell,
+  // and the explicit scheme keeps its own (see buildExplicitCoefficients).
+  if (foundation.numericalScheme == Foundation::NS_ADE ||
+      foundation.numericalScheme == Foundation::NS_ADI) {
+    cellCoeffs.assign(num_cells, CellCoeffs{{{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}});
+  } else {
+    cellCoeffs.clear();
+    cellCoeffs.shrink_to_fit();
+  }
+  cellCoeffsValid = false;
+
+  adaptiveTimestep = 0.0;
+
+  const bool cylindrical = foundation.coordinateSystem == Foundation::CS_CYLINDRICAL;
+  switch (foundation.numberOfDimensions) {
+  case 1:
+    pCalculateTemperatures = &Ground::calculateTemperatures<1, false>;
+    break;
+  case 2:
+    pCalculateTemperatures = cylindrical ? &Ground::calculateTemperatures<2, true>
+                                         : &Ground::calculateTemperatures<2, false>;
+    break;
+  default:
+    pCalculateTemperatures = cylindrical ? &Ground::calculateTemperatures<3, true>
+                                         : &Ground::calculateTemperatures<3, false>;
+    break;
+  }
 
-  TNew.resize(num_cells);
-  TOld.resize(num_cells);
+  // The initial values are the first guess of iterative steady-state solutions
+  TNew.assign(num_cells, 283.15);
+  TOld.assign(num_cells, 283.15);
 
   link_cells_to_temp();
 }
 
-void Ground::calculateADE() {
-// Solve for new values (Main loop)
-#pragma omp parallel sections num_threads(2)
-  {
-#pragma omp section
-    calculateADEUpwardSweep();
-#pragma omp section
-    calculateADEDownwardSweep();
+void Ground::setInitialTemperatures(const std::vector<double> &temperatures) {
+  if (temperatures.size() != num_cells) {
+    showMessage(MSG_ERR, "The number of initial temperatures does not match the number of cells.");
+  }
+  TNew = temperatures;
+  TOld = temperatures;
+}
+
+static const std::size_t ADE_BLOCK_SIZE[3] = {32, 8, 8};
+
+void Ground::buildADEBlocks() {
+  const std::size_t n[3] = {nX, nY, nZ};
+  std::size_t numBlocks[3];
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    numBlocks[dim] = (n[dim] + ADE_BLOCK_SIZE[dim] - 1) / ADE_BLOCK_SIZE[dim];
   }
-  for (size_t index = 0; index < num_cells; ++index) {
+
+  adeBlocks.clear();
+  adeWavefronts.clear();
+  const std::size_t numWavefronts = numBlocks[0] + numBlocks[1] + numBlocks[2] - 2;
+  for (std::size_t front = 0; front < numWavefronts; front++) {
+    adeWavefronts.push_back(adeBlocks.size());
+    for (std::size_t K = 0; K < numBlocks[2] && K <= front; K++) {
+      for (std::size_t J = 0; J < numBlocks[1] && J + K <= front; J++) {
+        const std::size_t I = front - J - K;
+        if (I >= numBlocks[0]) {
+          continue;
+        }
+        const std::size_t blockIndex[3] = {I, J, K};
+        ADEBlock block;
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          block.begin[dim] = blockIndex[dim] * ADE_BLOCK_SIZE[dim];
+          block.end[dim] = std::min(block.begin[dim] + ADE_BLOCK_SIZE[dim], n[dim]);
+        }
+        adeBlocks.push_back(block);
+      }
+    }
+  }
+  adeWavefronts.push_back(adeBlocks.size());
+}
+
+template <int N, bool CYLINDRICAL> void Ground::calculateADE() {
+  swapTemperatures();
+  updateCellCoeffs<N, CYLINDRICAL>(Foundation::NS_ADE);
+
+  // Solve for new values (Main loop). The upward sweep visits the wavefronts in order and the
+  // downward sweep in reverse order, so blocks from both sweeps share each parallel step.
+  const std::size_t numWavefronts = adeWavefronts.size() - 1;
+  for (std::size_t front = 0; front < numWavefronts; front++) {
+    const std::size_t upBegin = adeWavefronts[front];
+    const std::size_t downBegin = adeWavefronts[numWavefronts - 1 - front];
+    const std::ptrdiff_t numUp = adeWavefronts[front + 1] - upBegin;
+    const std::ptrdiff_t numBlocks = numUp + adeWavefronts[numWavefronts - front] - downBegin;
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t task = 0; task < numBlocks; ++task) {
+      if (task < numUp) {
+        calculateADEUpwardSweep<N, CYLINDRICAL>(adeBlocks[upBegin + task]);
+      } else {
+        calculateADEDownwardSweep<N, CYLINDRICAL>(adeBlocks[downBegin + (task - numUp)]);
+      }
+    }
+  }
+
+  const std::ptrdiff_t n = num_cells;
+#pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t index = 0; index < n; ++index) {
     TNew[index] = 0.5 * (U[index] + V[index]);
+  }
+}
 
-    // Update old values for next timestep
-    TOld[index] = TNew[index];
+template <int N, bool CYLINDRICAL> void Ground::calculateADEUpwardSweep(const ADEBlock &block) {
+  // Upward sweep (Solve U Matrix starting from 1, 1). The sweep order couples neighboring cells,
+  // so partitions do not apply here; conduction cells still skip the virtual call.
+  const CellStore &store = *domain.cellStore;
+  for (size_t k = block.begin[2]; k < block.end[2]; k++) {
+    for (size_t j = block.begin[1]; j < block.end[1]; j++) {
+      for (size_t i = block.begin[0]; i < block.end[0]; i++) {
+        size_t index = i + nX * j + nX * nY * k;
+        if (isConductionCell(store.cellType[index])) {
+          store.calcCellADEUp<N>(index, timestep, cellCoeffs[index].C, U.data());
+        } else {
+          domain.cell[index]->calcCellADEUp(timestep, foundation, bcs, U[index]);
+        }
+      }
+    }
   }
 }
 
-void Ground::calculateADEUpwardSweep() {
-  // Upward sweep (Solve U Matrix starting from 1, 1)
+template <int N, bool CYLINDRICAL> void Ground::calculateADEDownwardSweep(const ADEBlock &block) {
+  // Downward sweep (Solve V Matrix starting from I, K)
+  const CellStore &store = *domain.cellStore;
+  for (size_t k = block.end[2]; k-- > block.begin[2];) {
+    for (size_t j = block.end[1]; j-- > block.begin[1];) {
+      for (size_t i = block.end[0]; i-- > block.begin[0];) {
+        size_t index = i + nX * j + nX * nY * k;
+        if (isConductionCell(store.cellType[index])) {
+          store.calcCellADEDown<N>(index, timestep, cellCoeffs[index].C, V.data());
+        } else {
+          domain.cell[index]->calcCellADEDown(timestep, foundation, bcs, V[index]);
+        }
+      }
+    }
+  }
+}
+
+void Ground::buildExplicitCoefficients() {
+  explicitCells.clear();
+  explicitOtherCells.clear();
   for (size_t index = 0; index < num_cells; index++) {
-    auto this_cell = domain.cell[index];
-    this_cell->calcCellADEUp(timestep, foundation, bcs, U[index]);
+    if (isConductionCell(domain.cellStore->cellType[index])) {
+      explicitCells.push_back(index);
+    } else {
+      explicitOtherCells.push_back(index);
+    }
+  }
+
+  const bool cylindrical = foundation.coordinateSystem == Foundation::CS_CYLINDRICAL;
+  const std::size_t n = explicitCells.size();
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    explicitCoeffs[dim][0].assign(n, 0.0);
+    explicitCoeffs[dim][1].assign(n, 0.0);
+    explicitStep[dim] = 0;
+  }
+  explicitGain.assign(n, 0.0);
+
+  // Forward Euler is stable while the weight of a cell's own temperature stays non-negative:
+  // dt*(sum of coefficients) <= 1. The limit covers normal and zero-thickness cells. Boundary
+  // cells are updated from their neighbors' temperatures without a heat capacity of their own, and
+  // their coefficients (with the properties of the adjacent material) are included as a
+  // conservative bound. Air cells do not limit the timestep.
+  explicitTimestepLimit = std::numeric_limits<double>::infinity();
+  auto limitTimestep = [&](const Cell &this_cell, double (&C)[3][2]) {
+    this_cell.store->gatherCCoeffs(this_cell.index, this_cell.store->iHeatCapacity[this_cell.index],
+                                   cylindrical, C);
+    double sum{0};
+    for (auto dim : this_cell.store->dims) {
+      if (dim < 5) {
+        sum += C[dim][1] - C[dim][0];
+      }
+    }
+    if (sum > 0.0) {
+      explicitTimestepLimit = std::min(explicitTimestepLimit, 1.0 / sum);
+    }
+  };
+  for (std::size_t c = 0; c < n; c++) {
+    double C[3][2]{{0}};
+    limitTimestep(*domain.cell[explicitCells[c]], C);
+    for (auto dim : domain.cell[explicitCells[c]]->dims()) {
+      if (dim < 5) {
+        explicitCoeffs[dim][0][c] = -C[dim][0];
+        explicitCoeffs[dim][1][c] = C[dim][1];
+        explicitStep[dim] = domain.stepsize[dim];
+      }
+    }
+  }
+  for (auto index : explicitOtherCells) {
+    if (domain.cellStore->cellType[index] == CellType::BOUNDARY) {
+      double C[3][2]{{0}};
+      limitTimestep(*domain.cell[index], C);
+    }
   }
 }
 
-void Ground::calculateADEDownwardSweep() {
-  // Downward sweep (Solve V Matrix starting from I, K)
-  for (size_t index = num_cells - 1; /* i >= 0 && */ index < num_cells; index--) {
-    auto this_cell = domain.cell[index];
-    this_cell->calcCellADEDown(timestep, foundation, bcs, V[index]);
+template <int N, bool CYLINDRICAL> void Ground::updateCellCoeffs(Foundation::NumericalScheme scheme) {
+  if (cellCoeffsValid && timestep == cellCoeffsTimestep && scheme == cellCoeffsScheme) {
+    return;
   }
+
+  const CellStore &store = *domain.cellStore;
+  for (const auto &partition : domain.cellPartitions) {
+    if (!partition.isConduction()) {
+      continue;
+    }
+    const std::ptrdiff_t n = partition.indices.size();
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t p = 0; p < n; ++p) {
+      const std::size_t index = partition.indices[p];
+      double theta = scheme == Foundation::NS_ADI ? store.thetaADI(index, timestep)
+                                                  : timestep * store.iHeatCapacity[index];
+      store.gatherCCoeffs<N, CYLINDRICAL>(index, theta, cellCoeffs[index].C);
+    }
+  }
+
+  cellCoeffsValid = true;
+  cellCoeffsTimestep = timestep;
+  cellCoeffsScheme = scheme;
 }
 
 void Ground::calculateExplicit() {
-  for (size_t index = 0; index < num_cells; index++) {
-    auto this_cell = domain.cell[index];
-    TNew[index] = this_cell->calcCellExplicit(timestep, foundation, bcs);
+  // Sub-step within the requested timestep to stay within the stability limit
+  std::size_t numSubsteps = 1;
+  if (timestep > explicitTimestepLimit) {
+    numSubsteps = static_cast<std::size_t>(std::ceil(timestep / explicitTimestepLimit));
+  }
+  const double dt = timestep / numSubsteps;
+
+  const std::ptrdiff_t nConduction = explicitCells.size();
+  const std::ptrdiff_t nOther = explicitOtherCells.size();
+  const CellStore &store = *domain.cellStore;
+
+#pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t c = 0; c < nConduction; ++c) {
+    const std::size_t index = explicitCells[c];
+    explicitGain[c] = store.heatGain[index] * store.iHeatCapacity[index];
+  }
+
+  // One parallel region for all sub-timesteps. Each loop ends with an implicit barrier.
+#pragma omp parallel
+  for (std::size_t substep = 0; substep < numSubsteps; substep++) {
+    // The previous sub-timestep's solution becomes TOld
+#pragma omp single
+    swapTemperatures();
+
+    const double *T = TOld.data();
+    double *T_new = TNew.data();
+
+#pragma omp for schedule(static)
+    for (std::ptrdiff_t c = 0; c < nConduction; ++c) {
+      const std::size_t index = explicitCells[c];
+      const double Tc = T[index];
+      double dTdt = explicitGain[c];
+      for (std::size_t dim = 0; dim < 3; dim++) {
+        dTdt += explicitCoeffs[dim][1][c] * (T[index + explicitStep[dim]] - Tc) +
+                explicitCoeffs[dim][0][c] * (T[index - explicitStep[dim]] - Tc);
+      }
+      T_new[index] = Tc + dt * dTdt;
+    }
+
+#pragma omp for schedule(static)
+    for (std::ptrdiff_t c = 0; c < nOther; ++c) {
+      const std::size_t index = explicitOtherCells[c];
+      T_new[index] = domain.cell[index]->calcCellExplicit(dt, foundation, bcs);
+    }
   }
-  TOld.assign(TNew.begin(), TNew.end());
 }
 
-void Ground::calculateMatrix(Foundation::NumericalScheme scheme) {
-  for (std::size_t index = 0; index < num_cells; index++) {
-    auto this_cell = domain.cell[index];
-    double A, bVal;
-    double Alt[3][2] = {{0}};
-    this_cell->calcCellMatrix(scheme, timestep, foundation, bcs, A, Alt, bVal);
-    setAmatValue(index, index, A);
-    for (std::size_t dim = 0; dim < 3; dim++) {
-      if (Alt[dim][0] != 0) {
-        setAmatValue(index, this_cell->index - domain.stepsize[dim], Alt[dim][0]);
+template <int N, bool CYLINDRICAL> void Ground::calculateMatrix(Foundation::NumericalScheme scheme) {
+  swapTemperatures();
+
+  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
+      TDMA) {
+    for (const auto &partition : domain.cellPartitions) {
+      for (auto index : partition.indices) {
+        double A, bVal;
+        double Alt[3][2] = {{0}};
+        calcCellMatrix<N, CYLINDRICAL>(partition, index, scheme, A, Alt, bVal);
+        // Tridiagonal coefficients: lower, diagonal and upper
+        a2[index] = A;
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          if (Alt[dim][0] != 0) {
+            a1[index] = Alt[dim][0];
+          }
+          if (Alt[dim][1] != 0) {
+            a3[index] = Alt[dim][1];
+          }
+        }
+        b_[index] = bVal;
       }
-      if (Alt[dim][1] != 0) {
-        setAmatValue(index, this_cell->index + domain.stepsize[dim], Alt[dim][1]);
+    }
+  } else if (matrixFree) {
+    if (x.size() == 0) {
+      allocateSystem();
+    }
+    // Coefficients are stored by cell for the matrix-free operator
+    for (const auto &partition : domain.cellPartitions) {
+      const std::ptrdiff_t n = partition.indices.size();
+
+#pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t p = 0; p < n; ++p) {
+        const std::size_t index = partition.indices[p];
+        double A, bVal;
+        double Alt[3][2] = {{0}};
+        calcCellMatrix<N, CYLINDRICAL>(partition, index, scheme, A, Alt, bVal);
+        stencil.diagonal[index] = A;
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          if (!stencil.neighbor[dim][0].empty()) {
+            stencil.neighbor[dim][0][index] = Alt[dim][0];
+            stencil.neighbor[dim][1][index] = Alt[dim][1];
+          }
+        }
+        b(index) = bVal;
       }
     }
-    setbValue(index, bVal);
+  } else {
+    // A change of scheme or timestep is a different operator, not a gradual change in boundary
+    // coefficients, so the preconditioner of the previous one is not reused for it. Amat still
+    // holds the previous matrix here.
+    const bool switched = scheme != preconditionerScheme || timestep != preconditionerTimestep;
+    if (switched) {
+      selectPreconditioner(scheme);
+    }
+    if (x.size() == 0) {
+      allocateSystem();
+    }
+
+    // Fixed-temperature cells are not part of the system. Their temperatures are set first and
+    // moved to the right-hand side of their neighbors' rows.
+    double fixedRhsSquaredNorm = 0.0;
+    for (const auto &partition : domain.cellPartitions) {
+      if (partition.isFixedTemperature()) {
+        for (auto index : partition.indices) {
+          double A, bVal;
+          double Alt[3][2] = {{0}};
+          calcCellMatrix<N, CYLINDRICAL>(partition, index, scheme, A, Alt, bVal);
+          TNew[index] = bVal / A;
+          fixedRhsSquaredNorm += bVal * bVal;
+        }
+      }
+    }
+
+    // Each row only writes its own slots in Amat, so rows are assembled independently
+    // OpenMP only reduces into local variables (not references), so `changed` is updated after
+    // the loops
+    auto assemble = [&](bool &changed) {
+      bool inPattern = true;
+      bool rowChanged = false;
+      double rhsSquaredNorm = fixedRhsSquaredNorm;
+      for (const auto &partition : domain.cellPartitions) {
+        if (partition.isFixedTemperature()) {
+          continue;
+        }
+        const std::ptrdiff_t n = partition.indices.size();
+
+#pragma omp parallel for schedule(static) reduction(|| : rowChanged) reduction(&& : inPattern) \
+    reduction(+ : rhsSquaredNorm)
+        for (std::ptrdiff_t p = 0; p < n; ++p) {
+          const std::size_t index = partition.indices[p];
+          const std::size_t row = domain.activeIndex[index];
+          double A, bVal;
+          double Alt[3][2] = {{0}};
+          calcCellMatrix<N, CYLINDRICAL>(partition, index, scheme, A, Alt, bVal);
+          rhsSquaredNorm += bVal * bVal;
+          foldFixedNeighbors(index, Alt, bVal);
+          inPattern = setAmatRow(row, A, Alt, rowChanged) && inPattern;
+          b(row) = bVal;
+        }
+      }
+      changed = changed || rowChanged;
+      fullRhsNorm = std::sqrt(rhsSquaredNorm);
+      return inPattern;
+    };
+
+    if (AmatSlots.empty()) {
+      buildAmatPattern(scheme);
+    }
+    bool changed = false;
+    if (!assemble(changed)) {
+      // A coefficient became nonzero outside of the pattern (e.g., after a change of scheme)
+      buildAmatPattern(scheme);
+      assemble(changed);
+    }
+
+    if (switched && preconditionerValid) {
+      // A preconditioner kept for this timestep is current if this is the matrix it was computed
+      // from
+      preconditionerStale =
+          preconditionerMatrix.size() != static_cast<std::size_t>(Amat.nonZeros()) ||
+          !std::equal(preconditionerMatrix.begin(), preconditionerMatrix.end(), Amat.valuePtr());
+    } else if (changed) {
+      preconditionerStale = true;
+    }
   }
 
+  // The solution is written directly to TNew
   solveLinearSystem();
-
-  // Read solution into temperature matrix
-  TNew = getXvalues();
-  // Update old values for next timestep
-  TOld.assign(TNew.begin(), TNew.end());
   clearAmat();
 }
 
-void Ground::calculateADI(int dim) {
-  double A, Alt[2], bVal;
-
-  auto dest_index = domain.dest_index_vector[dim].begin();
-  auto cell_iter = domain.cell.begin();
-  for (; dest_index < domain.dest_index_vector[dim].end(); ++cell_iter, ++dest_index) {
-    A = 0.0;
-    Alt[0] = 0.0;
-    Alt[1] = 0.0;
-    bVal = 0.0;
-    (*cell_iter)->calcCellADI(dim, timestep, foundation, bcs, A, Alt, bVal);
-    setValuesADI(*dest_index, A, Alt, bVal);
+template <int N, bool CYLINDRICAL> void Ground::calculateADI(int dim) {
+  swapTemperatures();
+  updateCellCoeffs<N, CYLINDRICAL>(Foundation::NS_ADI);
+
+  // Lines along X are contiguous in the natural (i, j, k) cell order. With vector kernels, their
+  // coefficients are interleaved in groups of lines (see interleavedLineIndex) so that a group is
+  // solved together, and the solutions are copied back to the natural order afterwards. Y and Z
+  // coefficients are stored in the natural order. Every entry is overwritten here, so the arrays
+  // do not need to be cleared between directions.
+  const std::size_t lineLength = domain.dim_lengths[dim];
+  const std::size_t numLines = num_cells / lineLength;
+  const std::size_t chunkWidth = tdmBatchWidth();
+  const bool interleaved = dim == 0 && chunkWidth > 1;
+  for (const auto &partition : domain.cellPartitions) {
+    const std::ptrdiff_t n = partition.indices.size();
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t p = 0; p < n; ++p) {
+      const std::size_t index = partition.indices[p];
+      double A{0.0}, Alt[2]{0.0, 0.0}, bVal{0.0};
+      calcCellADI<N, CYLINDRICAL>(partition, index, dim, A, Alt, bVal);
+      setValuesADI(interleaved ? interleavedLineIndex(index / lineLength, index % lineLength,
+                                                      lineLength, numLines)
+                               : index,
+                   A, Alt, bVal);
+    }
   }
 
-  solveLinearSystem();
+  if (interleaved) {
+    const std::ptrdiff_t numGroups = (numLines + chunkWidth - 1) / chunkWidth;
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t group = 0; group < numGroups; ++group) {
+      const std::size_t groupWidth = std::min(chunkWidth, numLines - group * chunkWidth);
+      const std::size_t start = group * chunkWidth * lineLength;
+      solveTDMBatch(&a1[start], &a2[start], &a3[start], &b_[start], &b_[start], lineLength,
+                    groupWidth, groupWidth);
+      for (std::size_t lane = 0; lane < groupWidth; lane++) {
+        for (std::size_t i = 0; i < lineLength; i++) {
+          TNew[start + lane * lineLength + i] = b_[start + i * groupWidth + lane];
+        }
+      }
+    }
+    return;
+  }
 
-  std::size_t index{0};
-  dest_index = domain.dest_index_vector[dim].begin();
-  for (; dest_index < domain.dest_index_vector[dim].end(); ++index, ++dest_index) {
-    TNew[index] = x_[*dest_index];
+  // Lines along `dim` have elements `stride` apart. The domain divides into blocks of `stride`
+  // adjacent lines (an i-row of lines for Y, every (i, j) column for Z). Within a block,
+  // neighboring lines are solved together in chunks of contiguous lanes, so each step along the
+  // lines reads whole cache lines. Solutions are written directly to TNew.
+  const std::size_t stride = domain.stepsize[dim];
+  const std::size_t blockSize = stride * lineLength;
+  const std::size_t chunksPerBlock = (stride + chunkWidth - 1) / chunkWidth;
+  const std::ptrdiff_t numChunks = (num_cells / blockSize) * chunksPerBlock;
+
+#pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t chunk = 0; chunk < numChunks; ++chunk) {
+    std::size_t firstLane = (chunk % chunksPerBlock) * chunkWidth;
+    std::size_t start = (chunk / chunksPerBlock) * blockSize + firstLane;
+    std::size_t lanes = std::min(chunkWidth, stride - firstLane);
+    solveTDMBatch(&a1[start], &a2[start], &a3[start], &b_[start], &TNew[start], lineLength, stride,
+                  lanes);
   }
+}
 
-  // Update old values for next timestep
-  TOld.assign(TNew.begin(), TNew.end());
+template <int N, bool CYLINDRICAL>
+void Ground::calcCellMatrix(const CellPartition &partition, std::size_t index,
+                            Foundation::NumericalScheme scheme, double &A, double (&Alt)[3][2],
+                            double &bVal) {
+  if (partition.isConduction() && scheme == Foundation::NS_STEADY_STATE) {
+    domain.cellStore->calcCellSteadyState<N, CYLINDRICAL>(index, A, Alt, bVal);
+  } else if (partition.isConduction()) {
+    const CellStore &store = *domain.cellStore;
+    double C[3][2]{{0}};
+    store.gatherCCoeffs<N, CYLINDRICAL>(index, timestep * store.iHeatCapacity[index], C);
+    store.calcCellMatrix<N>(index, scheme, timestep, C, A, Alt, bVal);
+  } else {
+    domain.cell[index]->calcCellMatrix(scheme, timestep, foundation, bcs, A, Alt, bVal);
+  }
+}
 
-  clearAmat();
+template <int N, bool CYLINDRICAL>
+void Ground::calcCellADI(const CellPartition &partition, std::size_t index, std::size_t dim,
+                         double &A, double (&Alt)[2], double &bVal) {
+  if (partition.isConduction()) {
+    domain.cellStore->calcCellADI<N>(index, dim, timestep, foundation.fADI, cellCoeffs[index].C,
+                                     A, Alt, bVal);
+  } else {
+    domain.cell[index]->calcCellADI(dim, timestep, foundation, bcs, A, Alt, bVal);
+  }
 }
 
 void Ground::calculate(BoundaryConditions &boundaryConditions, double ts) {
   bcs = boundaryConditions;
   timestep = ts;
+  // A system assembled while initializing with another scheme is not needed by this one
+  if (x.size() > 0 && !assemblesSystem()) {
+    releaseSystem();
+  }
   // update boundary conditions
   setBoundaryConditions();
 
   // Calculate Temperatures
+  (this->*pCalculateTemperatures)();
+}
+
+double Ground::calculateAdaptive(const BoundaryConditionsFunction &boundaryConditionsAt,
+                                 double minTimestep, double maxTimestep) {
+  if (foundation.numericalScheme != Foundation::NS_IMPLICIT &&
+      foundation.numericalScheme != Foundation::NS_CRANK_NICOLSON) {
+    showMessage(MSG_ERR,
+                "Adaptive timesteps require the Implicit or Crank-Nicolson numerical scheme.");
+  }
+
+  const double tolerance = foundation.adaptiveTimestepTolerance;
+  // Steps are minTimestep times a power of two (the nearest to the suggested length), so their half
+  // steps are also of these lengths and few preconditioners are needed (see selectPreconditioner)
+  double step = minTimestep;
+  while (2.0 * step <= maxTimestep && 2.0 * step <= std::sqrt(2.0) * adaptiveTimestep) {
+    step *= 2.0;
+  }
+  adaptiveTStart = TNew; // only allocates on the first call
+
+  // Surface averages of a single step of the current length. After a rejected step, the first of
+  // its half steps (in adaptiveTHalf) is the single step of half the length.
+  GroundOutput::OutputValues fullStep;
+  bool haveFullStep = false;
+
+  while (true) {
+    if (!haveFullStep) {
+      calculate(boundaryConditionsAt(step), step);
+      calculateSurfaceAverages();
+      if (step <= minTimestep) {
+        // The shortest step is always accepted, so its error is not estimated
+        adaptiveTimestep = std::min(2.0 * step, maxTimestep);
+        return step;
+      }
+      fullStep = groundOutput.outputValues;
+      TNew = adaptiveTStart;
+    } else if (step <= minTimestep) {
+      TNew = adaptiveTHalf;
+      bcs = boundaryConditionsAt(step);
+      setBoundaryConditions();
+      groundOutput.outputValues = fullStep;
+      adaptiveTimestep = std::min(2.0 * step, maxTimestep);
+      return step;
+    }
+
+    calculate(boundaryConditionsAt(0.5 * step), 0.5 * step);
+    calculateSurfaceAverages();
+    const GroundOutput::OutputValues halfStep = groundOutput.outputValues;
+    adaptiveTHalf = TNew;
+    calculate(boundaryConditionsAt(step), 0.5 * step);
+    calculateSurfaceAverages();
+
+    double error = 0.0;
+    for (auto surfaceType : groundOutput.outputMap) {
+      double difference = groundOutput.outputValues(surfaceType, GroundOutput::OT_FLUX) -
+                          fullStep(surfaceType, GroundOutput::OT_FLUX);
+      error = std::max(error, std::fabs(difference));
+    }
+
+    if (error <= tolerance) {
+      // The error of a step shrinks at least with the square of its length
+      double growth = error > 0.0 ? 0.9 * std::sqrt(tolerance / error) : 2.0;
+      adaptiveTimestep = step * std::min(2.0, std::max(0.5, growth));
+      return step;
+    }
+
+    TNew = adaptiveTStart;
+    if (0.5 * step >= minTimestep) {
+      step *= 0.5;
+      fullStep = halfStep;
+      haveFullStep = true;
+    } else {
+      step = minTimestep;
+      haveFullStep = false;
+    }
+  }
+}
+
+void Ground::calculatePeriodic(const BoundaryConditionsFunction &boundaryConditionsAt,
+                               double period, std::size_t numSamples, std::size_t numHarmonics) {
+  typedef std::complex<double> Complex;
+  typedef Eigen::SparseMatrix<Complex> ComplexMatrix;
+  typedef Eigen::BiCGSTAB<ComplexMatrix, Eigen::IncompleteLUT<Complex>> ComplexSolver;
+
+  // Rows of the steady-state system of the active cells (with fixed-temperature neighbors moved to
+  // the right-hand side), with coefficients averaged over the period. The system of a harmonic
+  // with angular frequency w subtracts i*w*(heat capacity) from the diagonal of conduction cells.
+  struct PeriodicRow {
+    double A;
+    double Alt[3][2];
+    double b; // constant rows only
+    double heatCapacity;
+  };
+  const std::size_t numActive = domain.activeCells.size();
+  std::vector<PeriodicRow> rows(numActive);
+
+  const bool cylindrical = foundation.coordinateSystem == Foundation::CS_CYLINDRICAL;
+  auto calcRow = [&](const CellPartition &partition, std::size_t index, double &A,
+                     double(&Alt)[3][2], double &bVal) {
+    if (cylindrical) {
+      calcCellMatrix<0, true>(partition, index, Foundation::NS_STEADY_STATE, A, Alt, bVal);
+    } else {
+      calcCellMatrix<0, false>(partition, index, Foundation::NS_STEADY_STATE, A, Alt, bVal);
+    }
+  };
+  auto neighborOf = [&](std::size_t index, std::size_t dim, std::size_t dir) -> std::size_t {
+    return dir == 0 ? index - domain.stepsize[dim] : index + domain.stepsize[dim];
+  };
+
+  // Only the rows of boundary cells (whose coefficients depend on the boundary conditions and
+  // surface temperatures) and of cells next to fixed-temperature cells vary over the period. They
+  // are evaluated at each sample. The residuals of the other (constant) rows follow directly from
+  // the harmonics of the solution.
+  std::vector<std::vector<CellIndex>> sampledIndices(domain.cellPartitions.size());
+  std::vector<std::size_t> constantRows, evaluatedRows;
+  for (std::size_t p = 0; p < domain.cellPartitions.size(); p++) {
+    const CellPartition &partition = domain.cellPartitions[p];
+    if (partition.isFixedTemperature()) {
+      continue;
+    }
+    for (auto index : partition.indices) {
+      const std::size_t row = domain.activeIndex[index];
+      PeriodicRow &periodicRow = rows[row];
+      periodicRow.heatCapacity =
+          partition.isConduction() ? 1.0 / domain.cellStore->iHeatCapacity[index] : 0.0;
+
+      if (partition.isConduction()) {
+        double A, bVal;
+        double Alt[3][2] = {{0}};
+        calcRow(partition, index, A, Alt, bVal);
+        bool fixedNeighbor = false;
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          for (std::size_t dir = 0; dir < 2; dir++) {
+            if (Alt[dim][dir] != 0 &&
+                domain.activeIndex[neighborOf(index, dim, dir)] == INACTIVE_CELL) {
+              fixedNeighbor = true;
+            }
+          }
+        }
+        if (!fixedNeighbor) {
+          periodicRow.A = A;
+          std::copy(&Alt[0][0], &Alt[0][0] + 6, &periodicRow.Alt[0][0]);
+          periodicRow.b = bVal;
+          constantRows.push_back(row);
+          continue;
+        }
+      }
+
+      // The temperatures of a sampled row and its neighbors are needed at each sample
+      sampledIndices[p].push_back(index);
+      evaluatedRows.push_back(row);
+      const CellIndex *coords = domain.cell[index]->coords;
+      for (std::size_t dim = 0; dim < 3; dim++) {
+        if (coords[dim] > 0 && domain.activeIndex[neighborOf(index, dim, 0)] != INACTIVE_CELL) {
+          evaluatedRows.push_back(domain.activeIndex[neighborOf(index, dim, 0)]);
+        }
+        if (coords[dim] + 1 < domain.dim_lengths[dim] &&
+            domain.activeIndex[neighborOf(index, dim, 1)] != INACTIVE_CELL) {
+          evaluatedRows.push_back(domain.activeIndex[neighborOf(index, dim, 1)]);
+        }
+      }
+    }
+  }
+  std::sort(evaluatedRows.begin(), evaluatedRows.end());
+  evaluatedRows.erase(std::unique(evaluatedRows.begin(), evaluatedRows.end()),
+                      evaluatedRows.end());
+
+  // Fourier coefficients of the solution (harmonic 0 is the mean) and of the residuals of each
+  // pass
+  std::vector<Eigen::VectorXcd> THat(numHarmonics + 1, Eigen::VectorXcd::Zero(numActive));
+  std::vector<Eigen::VectorXcd> rHat(numHarmonics + 1, Eigen::VectorXcd(numActive));
+  for (std::size_t row = 0; row < numActive; row++) {
+    THat[0](row) = TNew[domain.activeCells[row]];
+  }
+
+  auto setFixedTemperatures = [&]() {
+    for (const auto &partition : domain.cellPartitions) {
+      if (partition.isFixedTemperature()) {
+        for (auto index : partition.indices) {
+          double A, bVal;
+          double Alt[3][2] = {{0}};
+          calcRow(partition, index, A, Alt, bVal);
+          TNew[index] = bVal / A;
+        }
+      }
+    }
+  };
+
+  // Systems of the harmonics. The solver (and incomplete factorization) of each harmonic is
+  // computed on the first pass, and kept while later passes only update the coefficients.
+  std::vector<ComplexMatrix> Ak(numHarmonics + 1);
+  std::vector<std::unique_ptr<ComplexSolver>> solvers(numHarmonics + 1);
+
+  // Surface coefficients depend on the surface temperatures, and vary over the period. Each pass
+  // evaluates the residual of the current periodic solution at every sample (with coefficients
+  // from that solution), and corrects the solution with the averaged coefficients. A problem with
+  // constant coefficients is solved by the first pass.
+  std::vector<Complex> phase(numHarmonics + 1);
+  const std::ptrdiff_t numEvaluated = evaluatedRows.size();
+  const std::ptrdiff_t numConstant = constantRows.size();
+  for (std::size_t pass = 0; pass < PERIODIC_MAX_PASSES; pass++) {
+    for (const auto &indices : sampledIndices) {
+      for (auto index : indices) {
+        PeriodicRow &periodicRow = rows[domain.activeIndex[index]];
+        periodicRow.A = 0.0;
+        std::fill(&periodicRow.Alt[0][0], &periodicRow.Alt[0][0] + 6, 0.0);
+      }
+    }
+    for (auto &rk : rHat) {
+      rk.setZero();
+    }
+
+    for (std::size_t sample = 0; sample < numSamples; sample++) {
+      const double t = period * sample / numSamples;
+      for (std::size_t k = 0; k <= numHarmonics; k++) {
+        phase[k] = std::polar(1.0 / numSamples, -2.0 * PI * k * t / period);
+      }
+      bcs = boundaryConditionsAt(t);
+      setBoundaryConditions();
+      setFixedTemperatures();
+
+      // Current solution at the sample time
+#pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t e = 0; e < numEvaluated; ++e) {
+        const std::size_t row = evaluatedRows[e];
+        double T = THat[0](row).real();
+        for (std::size_t k = 1; k <= numHarmonics; k++) {
+          T += 2.0 * numSamples * (THat[k](row) * std::conj(phase[k])).real();
+        }
+        TOld[domain.activeCells[row]] = T;
+      }
+
+      for (std::size_t p = 0; p < domain.cellPartitions.size(); p++) {
+        const CellPartition &partition = domain.cellPartitions[p];
+        const std::vector<CellIndex> &indices = sampledIndices[p];
+        const std::ptrdiff_t np = indices.size();
+
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t c = 0; c < np; ++c) {
+          const std::size_t index = indices[c];
+          const std::size_t row = domain.activeIndex[index];
+          double A, bVal;
+          double Alt[3][2] = {{0}};
+          calcRow(partition, index, A, Alt, bVal);
+          foldFixedNeighbors(index, Alt, bVal);
+
+          PeriodicRow &periodicRow = rows[row];
+          periodicRow.A += A / numSamples;
+          double residual = bVal - A * TOld[index];
+          for (std::size_t dim = 0; dim < 3; dim++) {
+            for (std::size_t dir = 0; dir < 2; dir++) {
+              if (Alt[dim][dir] != 0) {
+                periodicRow.Alt[dim][dir] += Alt[dim][dir] / numSamples;
+                residual -= Alt[dim][dir] * TOld[neighborOf(index, dim, dir)];
+              }
+            }
+          }
+          for (std::size_t k = 0; k <= numHarmonics; k++) {
+            rHat[k](row) += residual * phase[k];
+          }
+        }
+      }
+    }
+
+    // Residual harmonics of the constant rows (the mean is real, as in the sampled rows)
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t c = 0; c < numConstant; ++c) {
+      const std::size_t row = constantRows[c];
+      const std::size_t index = domain.activeCells[row];
+      const PeriodicRow &periodicRow = rows[row];
+      for (std::size_t k = 0; k <= numHarmonics; k++) {
+        auto harmonic = [&](std::size_t r) {
+          return k == 0 ? Complex(THat[0](r).real()) : THat[k](r);
+        };
+        Complex residual = (k == 0 ? periodicRow.b : 0.0) - periodicRow.A * harmonic(row);
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          for (std::size_t dir = 0; dir < 2; dir++) {
+            if (periodicRow.Alt[dim][dir] != 0) {
+              residual -= periodicRow.Alt[dim][dir] *
+                          harmonic(domain.activeIndex[neighborOf(index, dim, dir)]);
+            }
+          }
+        }
+        rHat[k](row) = residual;
+      }
+    }
+
+    // Correct each harmonic. Rows are scaled by their diagonal so that the convergence tolerance
+    // applies to temperatures rather than to rows with large surface coefficients.
+    double change = 0.0;
+    std::vector<Eigen::Triplet<Complex>> tripletList;
+    tripletList.reserve(numActive * (1 + 2 * foundation.numberOfDimensions));
+    for (std::size_t k = 0; k <= numHarmonics; k++) {
+      const double w = 2.0 * PI * k / period;
+      tripletList.clear();
+      for (std::size_t row = 0; row < numActive; row++) {
+        const std::size_t index = domain.activeCells[row];
+        const PeriodicRow &periodicRow = rows[row];
+        const Complex capacitance(0.0, w * periodicRow.heatCapacity);
+        const Complex diagonal = periodicRow.A - capacitance;
+        const double scale = 1.0 / std::abs(diagonal);
+        tripletList.emplace_back(row, row, diagonal * scale);
+        for (std::size_t dim = 0; dim < 3; dim++) {
+          if (periodicRow.Alt[dim][0] != 0) {
+            tripletList.emplace_back(row, domain.activeIndex[index - domain.stepsize[dim]],
+                                     periodicRow.Alt[dim][0] * scale);
+          }
+          if (periodicRow.Alt[dim][1] != 0) {
+            tripletList.emplace_back(row, domain.activeIndex[index + domain.stepsize[dim]],
+                                     periodicRow.Alt[dim][1] * scale);
+          }
+        }
+        // The residual of the time derivative is not part of the sampled residuals
+        rHat[k](row) = (rHat[k](row) + capacitance * THat[k](row)) * scale;
+      }
+      ComplexMatrix matrix(numActive, numActive);
+      matrix.setFromTriplets(tripletList.begin(), tripletList.end());
+
+      const bool samePattern =
+          solvers[k] && matrix.nonZeros() == Ak[k].nonZeros() &&
+          std::equal(matrix.outerIndexPtr(), matrix.outerIndexPtr() + numActive + 1,
+                     Ak[k].outerIndexPtr()) &&
+          std::equal(matrix.innerIndexPtr(), matrix.innerIndexPtr() + matrix.nonZeros(),
+                     Ak[k].innerIndexPtr());
+      if (samePattern) {
+        // The solver refers to Ak[k], and keeps its factorization of the earlier coefficients
+        std::copy(matrix.valuePtr(), matrix.valuePtr() + matrix.nonZeros(), Ak[k].valuePtr());
+      } else {
+        Ak[k] = std::move(matrix);
+        solvers[k].reset(new ComplexSolver);
+        solvers[k]->setMaxIterations(foundation.maxIterations);
+        solvers[k]->setTolerance(foundation.tolerance);
+        solvers[k]->compute(Ak[k]);
+      }
+
+      ComplexSolver &solver = *solvers[k];
+      Eigen::VectorXcd correction = solver.solve(rHat[k]);
+      if (solver.info() != Eigen::Success) {
+        std::stringstream ss;
+        ss << "Periodic solution did not converge after " << solver.iterations()
+           << " iterations. The final residual was: (" << solver.error() << ").";
+        showMessage(MSG_ERR, ss.str());
+      }
+      THat[k] += correction;
+      change = std::max(change, (k == 0 ? 1.0 : 2.0) * correction.cwiseAbs().maxCoeff());
+    }
+    if (change < PERIODIC_TOLERANCE) {
+      break;
+    }
+    if (pass + 1 == PERIODIC_MAX_PASSES) {
+      std::stringstream ss;
+      ss << "Periodic solution did not settle after " << PERIODIC_MAX_PASSES
+         << " passes. The last change was " << change << " K.";
+      showMessage(MSG_WARN, ss.str());
+    }
+  }
+
+  // Superpose the harmonics at the start of the period
+  bcs = boundaryConditionsAt(0.0);
+  setBoundaryConditions();
+  setFixedTemperatures();
+  for (std::size_t row = 0; row < numActive; row++) {
+    double T = THat[0](row).real();
+    for (std::size_t k = 1; k <= numHarmonics; k++) {
+      T += 2.0 * THat[k](row).real();
+    }
+    TNew[domain.activeCells[row]] = T;
+  }
+  TOld = TNew;
+}
+
+template <int N, bool CYLINDRICAL> void Ground::calculateTemperatures() {
   switch (foundation.numericalScheme) {
   case Foundation::NS_ADE:
-    calculateADE();
+    calculateADE<N, CYLINDRICAL>();
     break;
   case Foundation::NS_EXPLICIT:
     calculateExplicit();
     break;
   case Foundation::NS_ADI: {
-    if (foundation.numberOfDimensions > 1)
-      calculateADI(0);
-    if (foundation.numberOfDimensions == 3)
-      calculateADI(1);
-    calculateADI(2);
+    if (N > 1)
+      calculateADI<N, CYLINDRICAL>(0);
+    if (N == 3)
+      calculateADI<N, CYLINDRICAL>(1);
+    calculateADI<N, CYLINDRICAL>(2);
   } break;
   case Foundation::NS_IMPLICIT:
-    calculateMatrix(Foundation::NS_IMPLICIT);
+    calculateMatrix<N, CYLINDRICAL>(Foundation::NS_IMPLICIT);
     break;
   case Foundation::NS_CRANK_NICOLSON:
-    calculateMatrix(Foundation::NS_CRANK_NICOLSON);
+    calculateMatrix<N, CYLINDRICAL>(Foundation::NS_CRANK_NICOLSON);
     break;
   case Foundation::NS_STEADY_STATE:
-    calculateMatrix(Foundation::NS_STEADY_STATE);
+    calculateMatrix<N, CYLINDRICAL>(Foundation::NS_STEADY_STATE);
     break;
   }
 }
 
-void Ground::setAmatValue(const int i, const int j, const double val) {
-  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
-      TDMA) {
-    if (j < i)
-      a1[i] = val;
-    else if (j == i)
-      a2[i] = val;
-    else
-      a3[i] = val;
-  } else {
-    tripletList.emplace_back(i, j, val);
-  }
-}
-
-void Ground::setbValue(const int i, const double val) {
-  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
-      TDMA) {
-    b_[i] = val;
-  } else {
-    b(i) = val;
+bool Ground::setAmatRow(const std::size_t &index, const double &A, const double (&Alt)[3][2],
+                        bool &changed) {
+  double *values = Amat.valuePtr();
+  const AmatRowSlots &slots = AmatSlots[index];
+  changed = changed || values[slots.diagonal] != A;
+  values[slots.diagonal] = A;
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    for (std::size_t dir = 0; dir < 2; dir++) {
+      const std::ptrdiff_t slot = slots.neighbor[dim][dir];
+      if (slot >= 0) {
+        changed = changed || values[slot] != Alt[dim][dir];
+        values[slot] = Alt[dim][dir];
+      } else if (Alt[dim][dir] != 0) {
+        return false;
+      }
+    }
   }
+  return true;
 }
 
 void Ground::setValuesADI(const std::size_t &index, const double &A, const double (&Alt)[2],
@@ -230,26 +1013,198 @@ void Ground::setValuesADI(const std::size_t &index, const double &A, const doubl
   b_[index] = bVal;
 }
 
+void Ground::buildAmatPattern(Foundation::NumericalScheme scheme) {
+  // The pattern holds the nonzero coefficients of each active cell's row, which are determined by
+  // its cell type and compute dimensions. Fixed-temperature neighbors are not part of the system.
+  const std::size_t numActive = domain.activeCells.size();
+  std::vector<Eigen::Triplet<double>> tripletList;
+  tripletList.reserve(numActive * (1 + 2 * foundation.numberOfDimensions));
+  for (std::size_t row = 0; row < numActive; row++) {
+    const std::size_t index = domain.activeCells[row];
+    double A, bVal;
+    double Alt[3][2] = {{0}};
+    domain.cell[index]->calcCellMatrix(scheme, timestep, foundation, bcs, A, Alt, bVal);
+    tripletList.emplace_back(row, row, A);
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      if (Alt[dim][0] != 0 && domain.activeIndex[index - domain.stepsize[dim]] != INACTIVE_CELL) {
+        tripletList.emplace_back(row, domain.activeIndex[index - domain.stepsize[dim]],
+                                 Alt[dim][0]);
+      }
+      if (Alt[dim][1] != 0 && domain.activeIndex[index + domain.stepsize[dim]] != INACTIVE_CELL) {
+        tripletList.emplace_back(row, domain.activeIndex[index + domain.stepsize[dim]],
+                                 Alt[dim][1]);
+      }
+    }
+  }
+  Amat.resize(numActive, numActive);
+  Amat.setFromTriplets(tripletList.begin(), tripletList.end());
+  Amat.makeCompressed();
+  buildAmatSlots();
+}
+
+bool Ground::assemblesSystem() const {
+  // The ADI sweeps (and one-dimensional domains) solve tridiagonal systems instead
+  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
+      TDMA) {
+    return false;
+  }
+  return foundation.numericalScheme == Foundation::NS_IMPLICIT ||
+         foundation.numericalScheme == Foundation::NS_CRANK_NICOLSON ||
+         foundation.numericalScheme == Foundation::NS_STEADY_STATE;
+}
+
+void Ground::allocateSystem() {
+  // The assembled system only holds the active cells. The matrix-free operator keeps every cell.
+  // Amat is sized with its pattern (see buildAmatPattern).
+  const std::size_t numActive = domain.activeCells.size();
+  b.resize(matrixFree ? num_cells : numActive);
+  x.resize(numActive);
+}
+
+void Ground::releaseSystem() {
+  Eigen::SparseMatrix<double>().swap(Amat); // assignment would keep the storage
+  AmatSlots = std::vector<AmatRowSlots>();
+  AmatPatternAnalyzed = false;
+  b.resize(0);
+  x.resize(0);
+  fullRhsNorm = 0.0;
+  if (!matrixFree) {
+    pSolver = makeSolver(); // without the factorization or preconditioner of the previous one
+  }
+  preconditionerValid = false;
+  preconditionerStale = false;
+  preconditionerIterationsRose = false;
+  preconditionerSolves = 0;
+  preconditionerIterations = 0;
+  preconditionerScheme = foundation.numericalScheme;
+  preconditionerTimestep = 0.0;
+  preconditionerMatrix = std::vector<double>();
+  preconditionerCache.clear();
+}
+
+void Ground::buildAmatSlots() {
+  // Locate row `i` within column `j` of the (column-major) pattern
+  auto slot = [this](std::size_t i, std::size_t j) -> std::ptrdiff_t {
+    const auto *first = Amat.innerIndexPtr() + Amat.outerIndexPtr()[j];
+    const auto *last = Amat.innerIndexPtr() + Amat.outerIndexPtr()[j + 1];
+    const auto *found = std::lower_bound(first, last, static_cast<int>(i));
+    return found != last && *found == static_cast<int>(i) ? found - Amat.innerIndexPtr() : -1;
+  };
+
+  const std::size_t numActive = domain.activeCells.size();
+  AmatSlots.resize(numActive);
+  for (std::size_t row = 0; row < numActive; row++) {
+    const std::size_t index = domain.activeCells[row];
+    const auto &this_cell = domain.cell[index];
+    AmatRowSlots &slots = AmatSlots[row];
+    slots.diagonal = slot(row, row);
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      slots.neighbor[dim][0] = slots.neighbor[dim][1] = -1;
+      if (this_cell->coords[dim] > 0) {
+        const CellIndex col = domain.activeIndex[index - domain.stepsize[dim]];
+        slots.neighbor[dim][0] = col != INACTIVE_CELL ? slot(row, col) : -1;
+      }
+      if (this_cell->coords[dim] + 1 < domain.dim_lengths[dim]) {
+        const CellIndex col = domain.activeIndex[index + domain.stepsize[dim]];
+        slots.neighbor[dim][1] = col != INACTIVE_CELL ? slot(row, col) : -1;
+      }
+    }
+  }
+
+  AmatPatternAnalyzed = false;
+  preconditionerValid = false;
+  preconditionerCache.clear();
+}
+
+void Ground::foldFixedNeighbors(std::size_t index, double (&Alt)[3][2], double &bVal) const {
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    for (std::size_t dir = 0; dir < 2; dir++) {
+      if (Alt[dim][dir] != 0) {
+        const std::size_t neighbor =
+            dir == 0 ? index - domain.stepsize[dim] : index + domain.stepsize[dim];
+        if (domain.activeIndex[neighbor] == INACTIVE_CELL) {
+          bVal -= Alt[dim][dir] * TNew[neighbor];
+          Alt[dim][dir] = 0.0;
+        }
+      }
+    }
+  }
+}
+
 void Ground::solveLinearSystem() {
   if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
       TDMA) {
-    solveTDM(a1, a2, a3, b_, x_);
+    solveTDM(a1, a2, a3, b_, TNew);
   } else {
     int iters;
     double residual;
 
     bool success;
 
-    Amat.setFromTriplets(tripletList.begin(), tripletList.end());
-    pSolver->compute(Amat);
-    x = pSolver->solveWithGuess(b, x);
+    if (matrixFree) {
+      // Solve directly into TNew, starting from the previous timestep's solution
+      Eigen::Map<Eigen::VectorXd> xNew(TNew.data(), num_cells);
+      Eigen::Map<const Eigen::VectorXd> xOld(TOld.data(), num_cells);
+
+      // The line preconditioner is cheap to compute, so it is always refreshed
+      pStencilSolver->compute(stencil);
+      pStencilSolver->solveWithGuess(b, xOld, xNew);
+      success = pStencilSolver->info() == Eigen::Success;
+      if (!success) {
+        iters = pStencilSolver->iterations();
+        residual = pStencilSolver->error();
+
+        std::stringstream ss;
+        ss << "Solution did not converge after " << iters
+           << " iterations. The final residual was: (" << residual << ").";
+        showMessage(MSG_ERR, ss.str());
+      }
+      return;
+    }
+
+    // Only the active cells are solved for, starting from their previous temperatures
+    const std::ptrdiff_t numActive = domain.activeCells.size();
+    for (std::ptrdiff_t row = 0; row < numActive; ++row) {
+      x(row) = TOld[domain.activeCells[row]];
+    }
+
+    // Iterative solvers stop at a residual relative to the norm of the right-hand side, which
+    // would be smaller without the fixed-temperature rows
+    const double rhsNorm = b.norm();
+    pSolver->setTolerance(rhsNorm > 0.0 ? foundation.tolerance * fullRhsNorm / rhsNorm
+                                        : foundation.tolerance);
+
+    if (preconditionerNeedsRefresh()) {
+      refreshPreconditioner();
+    }
+    pSolver->solveWithGuess(b, x, x);
     int status = pSolver->info();
 
+    if (status != Eigen::Success && preconditionerStale) {
+      // A preconditioner computed for an earlier matrix may not be good enough. Retry.
+      refreshPreconditioner();
+      pSolver->solveWithGuess(b, x, x);
+      status = pSolver->info();
+    }
+
+    for (std::ptrdiff_t row = 0; row < numActive; ++row) {
+      TNew[domain.activeCells[row]] = x(row);
+    }
+
+    iters = pSolver->iterations();
+    preconditionerSolves++;
+    if (preconditionerSolves == 1) {
+      preconditionerIterations = iters;
+    } else if (foundation.preconditionerIterationGrowth > 0.0 &&
+               iters > foundation.preconditionerIterationGrowth *
+                           std::max(preconditionerIterations, 1)) {
+      preconditionerIterationsRose = true;
+    }
+
     //    Eigen::saveMarket(Amat, "Amat.mtx");
     //    Eigen::saveMarketVector(b, "b.mtx");
     success = status == Eigen::Success;
     if (!success) {
-      iters = pSolver->iterations();
       residual = pSolver->error();
 
       std::stringstream ss;
@@ -260,37 +1215,116 @@ void Ground::solveLinearSystem() {
   }
 }
 
-void Ground::clearAmat() {
-  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
-      TDMA) {
-    std::fill(a1.begin(), a1.end(), 0.0);
-    std::fill(a2.begin(), a2.end(), 0.0);
-    std::fill(a3.begin(), a3.end(), 0.0);
-    std::fill(b_.begin(), b_.end(), 0.0);
+std::shared_ptr<LinearSolver> Ground::makeSolver() const {
+  std::shared_ptr<LinearSolver> solver = makeLinearSolver(foundation.linearSolver, domain);
+  solver->setMaxIterations(foundation.maxIterations);
+  solver->setTolerance(foundation.tolerance);
+  return solver;
+}
 
-  } else {
-    tripletList.clear();
-    tripletList.reserve(nX * nY * nZ * (1 + 2 * foundation.numberOfDimensions));
+void Ground::selectPreconditioner(Foundation::NumericalScheme scheme) {
+  if (scheme != preconditionerScheme || adaptiveTimestep == 0.0) {
+    // Only adaptive steps return to earlier timesteps
+    preconditionerCache.clear();
+    preconditionerValid = false;
+    preconditionerScheme = scheme;
+    preconditionerTimestep = timestep;
+    return;
   }
+
+  // If the outgoing preconditioner is current, Amat holds the matrix it was computed from
+  if (preconditionerValid && !preconditionerStale) {
+    preconditionerMatrix.assign(Amat.valuePtr(), Amat.valuePtr() + Amat.nonZeros());
+  }
+
+  auto cached = std::find_if(
+      preconditionerCache.begin(), preconditionerCache.end(),
+      [this](const CachedPreconditioner &entry) { return entry.timestep == timestep; });
+  if (cached == preconditionerCache.end()) {
+    if (!preconditionerValid) {
+      // Nothing to keep, so the solver is used for this timestep
+      preconditionerTimestep = timestep;
+      return;
+    }
+    if (preconditionerCache.size() < PRECONDITIONER_CACHE_SIZE) {
+      preconditionerCache.push_back(
+          CachedPreconditioner{makeSolver(), false, false, false, false, 0, 0, timestep, {}});
+      cached = preconditionerCache.end() - 1;
+    } else {
+      // The least recently used solver is recomputed for this timestep
+      cached = preconditionerCache.begin();
+      cached->valid = false;
+      cached->timestep = timestep;
+    }
+  }
+  swapPreconditioner(*cached);
+  // The outgoing preconditioner becomes the most recently used
+  std::rotate(cached, cached + 1, preconditionerCache.end());
 }
 
-double Ground::getxValue(const int i) {
-  if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
-      TDMA) {
-    return x_[i];
-  } else {
-    return x(i);
+void Ground::swapPreconditioner(CachedPreconditioner &cached) {
+  std::swap(pSolver, cached.solver);
+  std::swap(AmatPatternAnalyzed, cached.patternAnalyzed);
+  std::swap(preconditionerValid, cached.valid);
+  std::swap(preconditionerStale, cached.stale);
+  std::swap(preconditionerIterationsRose, cached.iterationsRose);
+  std::swap(preconditionerSolves, cached.solves);
+  std::swap(preconditionerIterations, cached.iterations);
+  std::swap(preconditionerTimestep, cached.timestep);
+  preconditionerMatrix.swap(cached.matrix);
+}
+
+bool Ground::reusesPreconditioner() const {
+  return !matrixFree && !pSolver->isDirect() &&
+         (foundation.preconditionerRefreshInterval > 0 ||
+          foundation.preconditionerIterationGrowth > 0.0);
+}
+
+bool Ground::preconditionerNeedsRefresh() {
+  if (!preconditionerValid) {
+    return true;
+  }
+  if (!preconditionerStale) {
+    return false;
+  }
+  if (pSolver->isDirect()) {
+    // A factorization of an earlier matrix would give the wrong solution
+    return true;
+  }
+  // Reuse a preconditioner computed for an earlier matrix only if a refresh limit is set
+  const int interval = foundation.preconditionerRefreshInterval;
+  if (interval <= 0 && foundation.preconditionerIterationGrowth <= 0.0) {
+    return true;
   }
+  return preconditionerIterationsRose || (interval > 0 && preconditionerSolves >= interval);
 }
 
-std::vector<double> Ground::getXvalues() {
+void Ground::refreshPreconditioner() {
+  if (!AmatPatternAnalyzed) {
+    pSolver->analyzePattern(Amat);
+    AmatPatternAnalyzed = true;
+  }
+  pSolver->factorize(Amat);
+  if (reusesPreconditioner()) {
+    // Kept for checkpoints, since later solutions may use this preconditioner with other values
+    preconditionerMatrix.assign(Amat.valuePtr(), Amat.valuePtr() + Amat.nonZeros());
+  }
+  preconditionerValid = true;
+  preconditionerStale = false;
+  preconditionerIterationsRose = false;
+  preconditionerSolves = 0;
+  preconditionerIterations = 0;
+}
+
+void Ground::clearAmat() {
   if ((foundation.numericalScheme == Foundation::NS_ADI || foundation.numberOfDimensions == 1) &&
       TDMA) {
-    return x_;
-  } else {
-    std::vector<double> v(x.data(), x.data() + x.rows());
-    return v;
+    std::fill(a1.begin(), a1.end(), 0.0);
+    std::fill(a2.begin(), a2.end(), 0.0);
+    std::fill(a3.begin(), a3.end(), 0.0);
+    std::fill(b_.begin(), b_.end(), 0.0);
   }
+  // Every entry in the fixed sparsity pattern of Amat is overwritten on each step
 }
 
 double Ground::getSurfaceArea(Surface::SurfaceType surfaceType) {
@@ -340,20 +1374,28 @@ void Ground::calculateSurfaceAverages() {
           output << "x, T, h, q, dx\n";
 #endif
 
-          for (auto index : surface.indices) {
-            auto this_cell = domain.cell[index];
-            double hc = surface.convectionAlgorithm(TNew[index], Tair, surface.hfTerm,
-                                                    surface.propPtr->roughness, surface.cosTilt);
-            double hr = getSimpleInteriorIRCoeff(surface.propPtr->emissivity, TNew[index], Trad);
-            double q = this_cell->heatGain;
+          const ConvectionAlgorithm &convectionAlgorithm = surface.convectionAlgorithm;
+          const double roughness = surface.propPtr->roughness;
+          const double emissivity = surface.propPtr->emissivity;
+          const double *heatGain = domain.cellStore->heatGain.data();
+          const CellIndex *indices = surface.indices.data();
+          const double *areas = surface.cellAreas.data();
+          const std::size_t numCells = surface.indices.size();
+
+          for (std::size_t c = 0; c < numCells; c++) {
+            const std::size_t index = indices[c];
+            const double T = TNew[index];
+            double hc = convectionAlgorithm(T, Tair, surface.hfTerm, roughness, surface.cosTilt);
+            double hr = getSimpleInteriorIRCoeff(emissivity, T, Trad);
+            double q = heatGain[index];
 
-            double &A = this_cell->area;
+            const double A = areas[c];
 
             double Ahc = A * hc;
             double Ahr = A * hr;
 
-            double Qc = Ahc * (Tair - TNew[index]);
-            double Qr = Ahr * (Trad - TNew[index]);
+            double Qc = Ahc * (Tair - T);
+            double Qr = Ahr * (Trad - T);
 
             totalArea += A;
 
@@ -365,7 +1407,7 @@ void Ground::calculateSurfaceAverages() {
             totalQr += Qr;
             totalQ += Qc + Qr + q * A;
 
-            TA += TNew[index] * A;
+            TA += T * A;
             TAconv += Tair * A;
 
 #ifdef PRNTSURF
@@ -388,26 +1430,26 @@ void Ground::calculateSurfaceAverages() {
       double hrAvg = hrA / totalArea;
       double hAvg = hA / totalArea;
 
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_TEMP}] = Tavg;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_AVG_TEMP}] = TA / totalArea;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_FLUX}] = totalQ / totalArea;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_RATE}] =
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_TEMP) = Tavg;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_AVG_TEMP) = TA / totalArea;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_FLUX) = totalQ / totalArea;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_RATE) =
         totalQ / totalArea * surfaceArea;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_CONV}] = hcAvg;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_RAD}] = hrAvg;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_CONV) = hcAvg;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_RAD) = hrAvg;
 
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_EFF_TEMP}] =
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_EFF_TEMP) =
         Tconv - (totalQ / totalArea) * (constructionRValue + 1 / hAvg) - 273.15;
     } else {
       double Tconv = bcs.slabConvectiveTemp;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_TEMP}] = Tconv;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_AVG_TEMP}] = Tconv;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_FLUX}] = 0.0;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_RATE}] = 0.0;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_CONV}] = 0.0;
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_RAD}] = 0.0;
-
-      groundOutput.outputValues[{surfaceType, GroundOutput::OT_EFF_TEMP}] = Tconv - 273.15;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_TEMP) = Tconv;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_AVG_TEMP) = Tconv;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_FLUX) = 0.0;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_RATE) = 0.0;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_CONV) = 0.0;
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_RAD) = 0.0;
+
+      groundOutput.outputValues(surfaceType, GroundOutput::OT_EFF_TEMP) = Tconv - 273.15;
     }
   }
 }
@@ -417,6 +1459,209 @@ Ground::getSurfaceAverageValue(std::pair<Surface::SurfaceType, GroundOutput::Out
   return groundOutput.outputValues[output];
 }
 
+double Ground::getSurfaceAverageValue(Surface::SurfaceType surfaceType,
+                                      GroundOutput::OutputType outputType) const {
+  return groundOutput.outputValues(surfaceType, outputType);
+}
+
+// Numeric values of the boundary conditions, in the order of their checkpoint record
+static std::array<double BoundaryConditions::*, 15> boundaryConditionValues() {
+  return {{&BoundaryConditions::slabConvectiveTemp, &BoundaryConditions::wallConvectiveTemp,
+           &BoundaryConditions::slabRadiantTemp, &BoundaryConditions::wallRadiantTemp,
+           &BoundaryConditions::outdoorTemp, &BoundaryConditions::localWindSpeed,
+           &BoundaryConditions::windDirection, &BoundaryConditions::solarAzimuth,
+           &BoundaryConditions::solarAltitude, &BoundaryConditions::directNormalFlux,
+           &BoundaryConditions::diffuseHorizontalFlux, &BoundaryConditions::skyEmissivity,
+           &BoundaryConditions::slabAbsRadiation, &BoundaryConditions::wallAbsRadiation,
+           &BoundaryConditions::deepGroundTemperature}};
+}
+
+void Ground::writeState(std::ostream &out) const {
+  StateWriter writer(out);
+  writer.write(TNew);
+  writer.write(TOld);
+  writer.write(x.data(), static_cast<std::size_t>(x.size()));
+
+  writer.writeInteger(static_cast<std::int64_t>(boundaryLayer.size()));
+  for (const auto &point : boundaryLayer) {
+    writer.write(point.first);
+    writer.write(point.second);
+  }
+
+  writer.write(groundOutput.outputValues.data(), groundOutput.outputValues.size());
+  writer.write(adaptiveTimestep);
+
+  // Preconditioners reused between matrices are restored from the matrices they were computed
+  // from, along with the current matrix and the counts that decide when they are refreshed
+  const bool savePreconditioners = reusesPreconditioner() && !AmatSlots.empty();
+  writer.writeInteger(savePreconditioners);
+  if (savePreconditioners) {
+    writer.writeInteger(preconditionerScheme);
+    for (Eigen::Index j = 0; j <= Amat.outerSize(); j++) {
+      writer.writeInteger(Amat.outerIndexPtr()[j]);
+    }
+    for (Eigen::Index i = 0; i < Amat.nonZeros(); i++) {
+      writer.writeInteger(Amat.innerIndexPtr()[i]);
+    }
+    writer.write(Amat.valuePtr(), static_cast<std::size_t>(Amat.nonZeros()));
+
+    auto writePreconditioner = [&writer](const CachedPreconditioner &entry) {
+      writer.write(entry.timestep);
+      writer.writeInteger(entry.valid);
+      writer.writeInteger(entry.stale);
+      writer.writeInteger(entry.iterationsRose);
+      writer.writeInteger(entry.solves);
+      writer.writeInteger(entry.iterations);
+      if (entry.valid) {
+        writer.write(entry.matrix);
+      }
+    };
+    writePreconditioner(CachedPreconditioner{
+        pSolver, AmatPatternAnalyzed, preconditionerValid, preconditionerStale,
+        preconditionerIterationsRose, preconditionerSolves, preconditionerIterations,
+        preconditionerTimestep, preconditionerMatrix});
+    writer.writeInteger(static_cast<std::int64_t>(preconditionerCache.size()));
+    for (const auto &entry : preconditionerCache) {
+      writePreconditioner(entry);
+    }
+  }
+
+  for (auto value : boundaryConditionValues()) {
+    writer.write(bcs.*value);
+  }
+}
+
+void Ground::readState(std::istream &in, BoundaryConditions &boundaryConditions) {
+  StateReader reader(in, "the ground state");
+  reader.read(TNew);
+  reader.read(TOld);
+  link_cells_to_temp();
+
+  reader.read(x.data(), static_cast<std::size_t>(x.size()));
+
+  boundaryLayer.resize(static_cast<std::size_t>(reader.readInteger()));
+  for (auto &point : boundaryLayer) {
+    point.first = reader.read();
+    point.second = reader.read();
+  }
+
+  reader.read(groundOutput.outputValues.data(), groundOutput.outputValues.size());
+  adaptiveTimestep = reader.read();
+
+  preconditionerValid = false;
+  preconditionerCache.clear();
+  if (reader.readInteger()) {
+    if (!reusesPreconditioner()) {
+      showMessage(MSG_ERR, "The ground state was written with different preconditioner settings.");
+    }
+    preconditionerScheme = static_cast<Foundation::NumericalScheme>(reader.readInteger());
+
+    const std::size_t numActive = domain.activeCells.size();
+    Amat.resize(numActive, numActive);
+    for (std::size_t j = 0; j <= numActive; j++) {
+      Amat.outerIndexPtr()[j] = static_cast<int>(reader.readInteger());
+    }
+    const std::size_t numNonZeros = Amat.outerIndexPtr()[numActive];
+    Amat.resizeNonZeros(numNonZeros);
+    for (std::size_t i = 0; i < numNonZeros; i++) {
+      Amat.innerIndexPtr()[i] = static_cast<int>(reader.readInteger());
+    }
+    buildAmatSlots();
+    std::vector<double> values(numNonZeros);
+    reader.read(values);
+
+    // Each preconditioner is recomputed from the values it was computed from
+    auto readPreconditioner = [&](CachedPreconditioner &entry) {
+      entry.timestep = reader.read();
+      entry.valid = reader.readInteger() != 0;
+      entry.stale = reader.readInteger() != 0;
+      entry.iterationsRose = reader.readInteger() != 0;
+      entry.solves = static_cast<int>(reader.readInteger());
+      entry.iterations = static_cast<int>(reader.readInteger());
+      entry.patternAnalyzed = false;
+      if (entry.valid) {
+        entry.matrix.resize(numNonZeros);
+        reader.read(entry.matrix);
+        std::copy(entry.matrix.begin(), entry.matrix.end(), Amat.valuePtr());
+        entry.solver->analyzePattern(Amat);
+        entry.solver->factorize(Amat);
+        entry.patternAnalyzed = true;
+      }
+    };
+    CachedPreconditioner current;
+    current.solver = pSolver;
+    readPreconditioner(current);
+    swapPreconditioner(current);
+    preconditionerCache.resize(static_cast<std::size_t>(reader.readInteger()));
+    for (auto &entry : preconditionerCache) {
+      entry.solver = makeSolver();
+      readPreconditioner(entry);
+    }
+    std::copy(values.begin(), values.end(), Amat.valuePtr());
+  }
+
+  for (auto value : boundaryConditionValues()) {
+    boundaryConditions.*value = reader.read();
+  }
+  setBoundaryConditions(boundaryConditions);
+}
+
+MemoryReport Ground::memoryReport() const {
+  MemoryReport report = domain.memoryReport();
+
+  std::size_t surfaceBytes = 0;
+  for (const auto &surface : foundation.surfaces) {
+    surfaceBytes += Kiva::memoryUsage(surface.indices) + Kiva::memoryUsage(surface.cellAreas) +
+                    Kiva::memoryUsage(surface.cellAbsorptivities);
+  }
+  report.add("Surface cells", surfaceBytes);
+
+  report.add("Temperatures", Kiva::memoryUsage(TNew) + Kiva::memoryUsage(TOld) +
+                                Kiva::memoryUsage(adaptiveTStart) +
+                                Kiva::memoryUsage(adaptiveTHalf));
+
+  report.add("ADE", Kiva::memoryUsage(U) + Kiva::memoryUsage(V) + Kiva::memoryUsage(adeBlocks) +
+                        Kiva::memoryUsage(adeWavefronts));
+
+  std::size_t explicitBytes = Kiva::memoryUsage(explicitCells) +
+                              Kiva::memoryUsage(explicitOtherCells) +
+                              Kiva::memoryUsage(explicitGain);
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    explicitBytes +=
+        Kiva::memoryUsage(explicitCoeffs[dim][0]) + Kiva::memoryUsage(explicitCoeffs[dim][1]);
+  }
+  report.add("Explicit", explicitBytes);
+
+  report.add("Stencil coefficients", Kiva::memoryUsage(cellCoeffs));
+
+  report.add("ADI", Kiva::memoryUsage(a1) + Kiva::memoryUsage(a2) + Kiva::memoryUsage(a3) +
+                        Kiva::memoryUsage(b_));
+
+  std::size_t matrixBytes = Kiva::memoryUsage(Amat) + Kiva::memoryUsage(AmatSlots) +
+                            Kiva::memoryUsage(b) + Kiva::memoryUsage(x) +
+                            Kiva::memoryUsage(preconditionerMatrix);
+  for (const auto &entry : preconditionerCache) {
+    matrixBytes += Kiva::memoryUsage(entry.matrix);
+  }
+  report.add("Matrix", matrixBytes);
+
+  std::size_t solverBytes = stencil.memoryUsage();
+  if (pSolver) {
+    solverBytes += pSolver->memoryUsage();
+  }
+  for (const auto &entry : preconditionerCache) {
+    solverBytes += entry.solver->memoryUsage();
+  }
+  if (pStencilSolver) {
+    solverBytes += pStencilSolver->preconditioner().memoryUsage();
+  }
+  report.add("Linear solver", solverBytes);
+
+  report.add("Boundary layer", Kiva::memoryUsage(boundaryLayer));
+
+  return report;
+}
+
 void Ground::calculateBoundaryLayer() {
   Foundation fd = foundation;
 
@@ -597,12 +1842,62 @@ void Ground::setNewBoundaryGeometry() {
   foundation.reductionLength2 = area / (perimeter - interiorPerimeter);
 }
 
+void Ground::interpolateTemperatures(const Ground &source) {
+  // Along each axis, the lower of the two source centers bounding each center, and the weight of
+  // the upper one
+  std::vector<std::size_t> lower[3];
+  std::vector<double> weight[3];
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    const std::vector<double> &from = source.domain.mesh[dim].centers;
+    const std::vector<double> &to = domain.mesh[dim].centers;
+    lower[dim].resize(to.size());
+    weight[dim].resize(to.size());
+    for (std::size_t i = 0; i < to.size(); i++) {
+      const std::size_t upper = std::upper_bound(from.begin(), from.end(), to[i]) - from.begin();
+      if (upper == 0 || upper == from.size()) {
+        lower[dim][i] = upper == 0 ? 0 : from.size() - 1;
+        weight[dim][i] = 0.0;
+      } else {
+        lower[dim][i] = upper - 1;
+        weight[dim][i] = (to[i] - from[upper - 1]) / (from[upper] - from[upper - 1]);
+      }
+    }
+  }
+
+  const std::size_t nXs = source.nX, nXYs = source.nX * source.nY;
+  for (std::size_t k = 0; k < nZ; k++) {
+    for (std::size_t j = 0; j < nY; j++) {
+      for (std::size_t i = 0; i < nX; i++) {
+        const std::size_t i0 = lower[0][i], j0 = lower[1][j], k0 = lower[2][k];
+        const std::size_t i1 = std::min(i0 + 1, source.nX - 1);
+        const std::size_t j1 = std::min(j0 + 1, source.nY - 1);
+        const std::size_t k1 = std::min(k0 + 1, source.nZ - 1);
+        const double wX = weight[0][i], wY = weight[1][j], wZ = weight[2][k];
+        auto T = [&](std::size_t is, std::size_t js, std::size_t ks) {
+          return source.TNew[is + nXs * js + nXYs * ks];
+        };
+        const double T0 = (1.0 - wY) * ((1.0 - wX) * T(i0, j0, k0) + wX * T(i1, j0, k0)) +
+                          wY * ((1.0 - wX) * T(i0, j1, k0) + wX * T(i1, j1, k0));
+        const double T1 = (1.0 - wY) * ((1.0 - wX) * T(i0, j0, k1) + wX * T(i1, j0, k1)) +
+                          wY * ((1.0 - wX) * T(i0, j1, k1) + wX * T(i1, j1, k1));
+        TNew[i + nX * j + nX * nY * k] = (1.0 - wZ) * T0 + wZ * T1;
+      }
+    }
+  }
+  TOld = TNew;
+}
+
+void Ground::setBoundaryConditions(BoundaryConditions &boundaryConditions) {
+  bcs = boundaryConditions;
+  setBoundaryConditions();
+}
+
 void Ground::setBoundaryConditions() {
 
-  double &azi = bcs.solarAzimuth;
-  double &alt = bcs.solarAltitude;
-  double &qDN = bcs.directNormalFlux;
-  double &qDH = bcs.diffuseHorizontalFlux;
+  const double &azi = bcs.solarAzimuth;
+  const double &alt = bcs.solarAltitude;
+  const double &qDN = bcs.directNormalFlux;
+  const double &qDH = bcs.diffuseHorizontalFlux;
   double qGH = cos(PI / 2 - alt) * qDN + qDH;
 
   double cosAlt = cos(alt);
@@ -612,9 +1907,6 @@ void Ground::setBoundaryConditions() {
       bool isWall = surface.type == Surface::ST_WALL_EXT;
 
       // Short wave
-      double pssf;
-      double q;
-
       double incidence = 0.0;
 
       if (surface.orientation == Surface::Z_POS) {
@@ -686,22 +1978,25 @@ void Ground::setBoundaryConditions() {
       double Fg = 1.0 - Fsky;
       double rho_g = 1.0 - foundation.grade.absorptivity;
 
-      for (auto index : surface.indices) {
-        auto this_cell = domain.cell[index];
-        double alpha = this_cell->surfacePtr->propPtr->absorptivity;
+      // Absorbed flux per unit absorptivity
+      double qIncident = 0.0;
+      if (qGH > 0.0) {
+        double pssf = incidence;
+        qIncident = qDN * pssf + qDH * Fsky + qGH * Fg * rho_g;
+      }
 
-        if (qGH > 0.0) {
-          pssf = incidence;
-          q = alpha * (qDN * pssf + qDH * Fsky + qGH * Fg * rho_g);
-        } else {
-          q = 0;
-        }
-        this_cell->heatGain = q;
+      double *heatGain = domain.cellStore->heatGain.data();
+      const CellIndex *indices = surface.indices.data();
+      const double *absorptivities = surface.cellAbsorptivities.data();
+      const std::size_t numCells = surface.indices.size();
+      for (std::size_t c = 0; c < numCells; c++) {
+        heatGain[indices[c]] = absorptivities[c] * qIncident;
       }
 
       // convection
-      ForcedConvectionTerm hfFunc = isWall ? bcs.extWallForcedTerm : bcs.gradeForcedTerm;
-      surface.hfTerm = hfFunc(surface.cosTilt, surface.azimuth, bcs.windDirection, bcs.localWindSpeed);
+      const ForcedConvectionTerm &hfFunc = isWall ? bcs.extWallForcedTerm : bcs.gradeForcedTerm;
+      surface.hfTerm =
+          hfFunc(surface.cosTilt, surface.azimuth, bcs.windDirection, bcs.localWindSpeed);
 
       surface.convectionAlgorithm =
           isWall ? bcs.extWallConvectionAlgorithm : bcs.gradeConvectionAlgorithm;
@@ -716,9 +2011,9 @@ void Ground::setBoundaryConditions() {
       bool isWall = surface.type == Surface::ST_WALL_INT;
       double absRadiation = isWall ? bcs.wallAbsRadiation : bcs.slabAbsRadiation;
 
+      double *heatGain = domain.cellStore->heatGain.data();
       for (auto index : surface.indices) {
-        auto this_cell = domain.cell[index];
-        this_cell->heatGain = absRadiation;
+        heatGain[index] = absRadiation;
       }
 
       surface.temperature = isWall ? bcs.wallConvectiveTemp : bcs.slabConvectiveTemp;
@@ -736,9 +2031,12 @@ void Ground::setBoundaryConditions() {
 }
 
 void Ground::link_cells_to_temp() {
-  for (auto this_cell : domain.cell) {
-    this_cell->told_ptr = &TOld[this_cell->index];
-  }
+  domain.cellStore->told = TOld.data();
+}
+
+void Ground::swapTemperatures() {
+  TOld.swap(TNew);
+  link_cells_to_temp();
 }
 
 double getArrayValue(std::vector<std::vector<std::vector<double>>> Mat, std::size_t i,
@@ -9,16 +9,21 @@
 #include "Domain.hpp"
 #include "Foundation.hpp"
 #include "GroundOutput.hpp"
+#include "LinearSolver.hpp"
 #include "Mesher.hpp"
+#include "StencilOperator.hpp"
 #include "libkiva_export.h"
 
+#include <algorithm>
 #include <cmath>
+#include <istream>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <ostream>
 #include <string>
 #include <vector>
 
-#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/SparseCore>
 
 namespace Kiva {
@@ -38,22 +43,78 @@ public:
 
   size_t nX, nY, nZ, num_cells;
 
+  // TNew holds the current solution. The buffers are swapped at the start of each timestep, so
+  // values written to TOld are not used: set initial temperatures with setInitialTemperatures.
   std::vector<double> TNew; // solution, n+1
   std::vector<double> TOld; // solution, n
 
   void buildDomain();
 
+  // Sets the current solution (TNew and TOld) to temperatures of every cell, in cell index order
+  void setInitialTemperatures(const std::vector<double> &temperatures);
+
   void calculateBoundaryLayer();
   void setNewBoundaryGeometry();
   void calculate(BoundaryConditions &boundaryConidtions, double ts = 0.0);
 
+  // Adaptive timestep control for the implicit and Crank-Nicolson schemes. Advances the solution
+  // by one step of minTimestep times a power of two, no longer than maxTimestep seconds, and
+  // calculates the surface averages. Each step longer than minTimestep is also taken as two half
+  // steps, and is only accepted (with the more accurate two-step solution) if the average heat
+  // fluxes of the output surfaces differ by no more than foundation.adaptiveTimestepTolerance.
+  // Otherwise it is retried at half the length. The first step tried is sized from the error of
+  // the last accepted step. Preconditioners of recently used step lengths are kept.
+  // boundaryConditionsAt(t) returns the conditions at t seconds after the current solution.
+  // Returns the length of the step taken.
+  typedef std::function<BoundaryConditions &(double)> BoundaryConditionsFunction;
+  double calculateAdaptive(const BoundaryConditionsFunction &boundaryConditionsAt,
+                           double minTimestep, double maxTimestep);
+
+  // Periodic steady state: sets TNew (and TOld) to the solution at the start of a period of
+  // boundary conditions that repeats indefinitely. boundaryConditionsAt(t) returns the conditions
+  // at t seconds into the period, and is sampled numSamples times. The solution is represented by
+  // its mean and first numHarmonics harmonics of the period, each found from a complex-valued
+  // linear system with the surface coefficients averaged over the period. Temperature-dependent
+  // surface coefficients are found by repeating the samples with the periodic solution until it
+  // settles, starting from the current TNew. Only the rows of boundary cells and of cells next to
+  // fixed-temperature cells vary, so only they are evaluated at each sample.
+  void calculatePeriodic(const BoundaryConditionsFunction &boundaryConditionsAt, double period,
+                         std::size_t numSamples, std::size_t numHarmonics);
+
+  // Sets TNew (and TOld) by linear interpolation of another domain's temperatures between its cell
+  // centers (constant beyond its outermost centers), e.g., to start from a solution on a coarser
+  // mesh of the same foundation
+  void interpolateTemperatures(const Ground &source);
+
+  // Sets the boundary conditions of the current solution without advancing it (e.g., for the
+  // surface averages of restored temperatures)
+  void setBoundaryConditions(BoundaryConditions &boundaryConditions);
+
   void calculateSurfaceAverages();
   double getSurfaceAverageValue(std::pair<Surface::SurfaceType, GroundOutput::OutputType> output);
+  double getSurfaceAverageValue(Surface::SurfaceType surfaceType,
+                                GroundOutput::OutputType outputType) const;
+
+  // Bytes held by each data structure. The matrix and linear solver are allocated on the first
+  // timestep of a scheme that uses them.
+  MemoryReport memoryReport() const;
+
+  // Binary state for checkpoints (see StateIO.hpp): the temperatures, the solution vector of the
+  // assembled system, the boundary layer, the surface averages, the adaptive step length, a
+  // preconditioner reused between matrices (see Foundation::preconditionerRefreshInterval), and the
+  // numeric values of the current boundary conditions. readState restores a state written for a
+  // domain built from the same inputs. The boundary conditions are copied into
+  // boundaryConditions (keeping its convection algorithms), which are then used as the current
+  // conditions of the restored solution.
+  void writeState(std::ostream &out) const;
+  void readState(std::istream &in, BoundaryConditions &boundaryConditions);
 
 private:
   double timestep; // in seconds
 
   friend class Aggregator;
+  // Copy of the conditions passed to the last call to calculate. Copying does not allocate unless
+  // a convection algorithm holds a callable too large for std::function's local storage.
   BoundaryConditions bcs;
   // Data structures
 
@@ -61,44 +122,149 @@ private:
   std::vector<double> U; // ADE upper sweep, n+1
   std::vector<double> V; // ADE lower sweep, n+1
 
+  // Blocks of cells for the ADE sweeps. A cell only depends on the cells before it (upward sweep)
+  // or after it (downward sweep) along each axis, so blocks on the same wavefront (equal sum of
+  // block indices) are independent and can be swept in parallel.
+  struct ADEBlock {
+    std::size_t begin[3];
+    std::size_t end[3];
+  };
+  std::vector<ADEBlock> adeBlocks;        // ordered by wavefront
+  std::vector<std::size_t> adeWavefronts; // index of the first block in each wavefront, and the end
+
+  // Explicit
+  std::vector<CellIndex> explicitCells;        // conduction (normal and zero-thickness) cells
+  std::vector<CellIndex> explicitOtherCells;   // boundary and air cells
+  std::vector<double> explicitCoeffs[3][2];    // [dim][dir] of each conduction cell, 1/s
+  std::vector<double> explicitGain;            // heat gain / heat capacity, K/s
+  std::size_t explicitStep[3];                 // stepsize, or 0 for dimensions not computed
+  double explicitTimestepLimit;                // largest stable sub-timestep, s
+
+  // Stencil coefficients of the conduction cells scaled by the timestep (C of
+  // CellStore::gatherCCoeffs), indexed by cell. They depend only on the timestep and geometry, so
+  // they are kept until the timestep or scheme changes. Only allocated for the ADE and ADI schemes.
+  struct CellCoeffs {
+    double C[3][2];
+  };
+  std::vector<CellCoeffs> cellCoeffs;
+  bool cellCoeffsValid;
+  double cellCoeffsTimestep;
+  Foundation::NumericalScheme cellCoeffsScheme;
+
   // ADI
   std::vector<double> a1; // lower diagonal
   std::vector<double> a2; // main diagonal
   std::vector<double> a3; // upper diagonal
   std::vector<double> b_; // right-hand side
-  std::vector<double> x_; // solution
 
   // Implicit
-  Eigen::SparseMatrix<double> Amat;
-  std::vector<Eigen::Triplet<double>> tripletList;
-  Eigen::VectorXd b, x;
-
-  std::shared_ptr<Eigen::BiCGSTAB<Eigen::SparseMatrix<double>, Eigen::IncompleteLUT<double>>>
-      pSolver;
+  Eigen::SparseMatrix<double> Amat; // sparsity pattern is fixed on first assembly
+  Eigen::VectorXd b; // right-hand side (active cells only, unless matrix-free)
+  Eigen::VectorXd x; // solution of the active cells (matrix-free solutions are mapped onto TNew)
+  // Norm of the right-hand side of the full system, with a row per fixed-temperature cell and
+  // before fixed neighbors are moved to the right-hand side. The convergence tolerance is relative
+  // to it, as if every cell were solved for.
+  double fullRhsNorm;
+
+  // Offsets into Amat.valuePtr() for the coefficients of each active cell's row (-1 if the
+  // coefficient is not in the pattern)
+  struct AmatRowSlots {
+    std::ptrdiff_t diagonal;
+    std::ptrdiff_t neighbor[3][2];
+  };
+  std::vector<AmatRowSlots> AmatSlots;
+
+  std::shared_ptr<LinearSolver> pSolver;
+  bool AmatPatternAnalyzed; // pSolver has analyzed the current sparsity pattern
+
+  // Matrix-free implicit (used instead of Amat and pSolver)
+  bool matrixFree;
+  StencilOperator stencil;
+  std::shared_ptr<BiCGSTAB<StencilOperator, StencilLinePreconditioner>> pStencilSolver;
+
+  // Adaptive timestep control
+  double adaptiveTimestep;            // length of the next step to try (0 before the first step)
+  std::vector<double> adaptiveTStart; // solution at the start of the step being attempted
+  std::vector<double> adaptiveTHalf;  // solution after the first half of the step
+
+  // Preconditioner (or direct factorization) reuse
+  bool preconditionerValid; // computed for the current sparsity pattern, scheme and timestep
+  bool preconditionerStale; // Amat values changed since the preconditioner was computed
+  bool preconditionerIterationsRose;
+  int preconditionerSolves;     // solutions using the current preconditioner
+  int preconditionerIterations; // iterations of the first solution with it
+  Foundation::NumericalScheme preconditionerScheme;
+  double preconditionerTimestep;
+  std::vector<double> preconditionerMatrix; // Amat values it was computed from, if it is reused
+
+  // Preconditioners of the other timesteps recently used with the same scheme and sparsity
+  // pattern, least recently used first. Adaptive steps alternate between a few lengths, so each
+  // keeps its solver and the reuse state above (swapped in by selectPreconditioner).
+  struct CachedPreconditioner {
+    std::shared_ptr<LinearSolver> solver;
+    bool patternAnalyzed;
+    bool valid;
+    bool stale;
+    bool iterationsRose;
+    int solves;
+    int iterations;
+    double timestep;
+    std::vector<double> matrix;
+  };
+  std::vector<CachedPreconditioner> preconditionerCache;
 
 private:
-  // Calculators (Called from main calculator)
-  void calculateADE();
+  // Calculators (Called from main calculator). Conduction kernels are specialized for the number
+  // of dimensions and the coordinate system of the domain, which are selected in buildDomain.
+  template <int N, bool CYLINDRICAL> void calculateTemperatures();
+  void (Ground::*pCalculateTemperatures)();
+
+  template <int N, bool CYLINDRICAL> void calculateADE();
 
-  void calculateADEUpwardSweep();
+  template <int N, bool CYLINDRICAL> void calculateADEUpwardSweep(const ADEBlock &block);
 
-  void calculateADEDownwardSweep();
+  template <int N, bool CYLINDRICAL> void calculateADEDownwardSweep(const ADEBlock &block);
 
   void calculateExplicit();
 
-  void calculateMatrix(Foundation::NumericalScheme scheme);
+  template <int N, bool CYLINDRICAL> void calculateMatrix(Foundation::NumericalScheme scheme);
+
+  template <int N, bool CYLINDRICAL> void calculateADI(int dim);
 
-  void calculateADI(int dim);
+  // Coefficients of one cell of a partition. Conduction cells use the CellStore kernels directly.
+  template <int N, bool CYLINDRICAL>
+  void calcCellMatrix(const CellPartition &partition, std::size_t index,
+                      Foundation::NumericalScheme scheme, double &A, double (&Alt)[3][2],
+                      double &bVal);
+  template <int N, bool CYLINDRICAL>
+  void calcCellADI(const CellPartition &partition, std::size_t index, std::size_t dim, double &A,
+                   double (&Alt)[2], double &bVal);
 
   // Misc. Functions
-  void setAmatValue(const int i, const int j, const double val);
-  void setbValue(const int i, const double val);
+  bool setAmatRow(const std::size_t &index, const double &A, const double (&Alt)[3][2],
+                  bool &changed);
   void setValuesADI(const std::size_t &index, const double &A, const double (&Alt)[2],
                     const double &bVal);
+  void buildADEBlocks();
+  void buildExplicitCoefficients();
+  template <int N, bool CYLINDRICAL> void updateCellCoeffs(Foundation::NumericalScheme scheme);
+  void buildAmatPattern(Foundation::NumericalScheme scheme);
+  void buildAmatSlots(); // for the current pattern of Amat
+  // The assembled system (Amat, b, x and its solvers) is only allocated while the current scheme
+  // assembles one, e.g., during an implicit initialization of an ADI simulation
+  bool assemblesSystem() const;
+  void allocateSystem();
+  void releaseSystem();
+  // Moves couplings to fixed-temperature neighbors (temperatures already in TNew) into bVal
+  void foldFixedNeighbors(std::size_t index, double (&Alt)[3][2], double &bVal) const;
   void solveLinearSystem();
+  bool reusesPreconditioner() const; // for more than one matrix (see Foundation)
+  std::shared_ptr<LinearSolver> makeSolver() const;
+  void selectPreconditioner(Foundation::NumericalScheme scheme);
+  void swapPreconditioner(CachedPreconditioner &cached);
+  bool preconditionerNeedsRefresh();
+  void refreshPreconditioner();
   void clearAmat();
-  double getxValue(const int i);
-  std::vector<double> getXvalues();
 
   double getSurfaceArea(Surface::SurfaceType surfaceType);
 
@@ -110,6 +276,7 @@ private:
 
   double getBoundaryDistance(double val);
   void link_cells_to_temp();
+  void swapTemperatures(); // TNew becomes TOld for the next (sub-)timestep
 };
 
 } // namespace Kiva
@@ -6,6 +6,9 @@
 
 #include "Foundation.hpp"
 
+#include <array>
+#include <utility>
+
 namespace Kiva {
 
 class GroundOutput {
@@ -22,6 +25,95 @@ public:
     OT_CONV,
     OT_RAD
   };
+  static const std::size_t NUM_OUTPUT_TYPES = OT_RAD + 1;
+
+  // Output values of every surface type, stored in a fixed-size array indexed by the enums.
+  // Subscripting, at, count, find and iteration (in key order) with (surface type, output type)
+  // pairs work as they did for the std::map this replaced, except that every pair is always
+  // present.
+  class OutputValues {
+  public:
+    typedef std::pair<Surface::SurfaceType, OutputType> key_type;
+    typedef double mapped_type;
+    typedef KeyedArrayIterator<OutputValues, double> iterator;
+    typedef KeyedArrayIterator<const OutputValues, const double> const_iterator;
+
+    OutputValues() {
+      for (auto &surfaceValues : values) {
+        surfaceValues.fill(0.0);
+      }
+    }
+
+    double &operator()(Surface::SurfaceType surfaceType, OutputType outputType) {
+      return values[surfaceType][outputType];
+    }
+    double operator()(Surface::SurfaceType surfaceType, OutputType outputType) const {
+      return values[surfaceType][outputType];
+    }
+
+    double &operator[](const key_type &output) { return values[output.first][output.second]; }
+    double operator[](const key_type &output) const {
+      return values[output.first][output.second];
+    }
+
+    // Throw std::out_of_range for values outside of the enums
+    double &at(const key_type &output) { return values.at(output.first).at(output.second); }
+    double at(const key_type &output) const { return values.at(output.first).at(output.second); }
+
+    std::size_t count(const key_type &output) const {
+      return static_cast<std::size_t>(output.first) < Surface::NUM_SURFACE_TYPES &&
+                     static_cast<std::size_t>(output.second) < NUM_OUTPUT_TYPES
+                 ? 1
+                 : 0;
+    }
+
+    iterator find(const key_type &output) { return iterator(this, position(output)); }
+    const_iterator find(const key_type &output) const {
+      return const_iterator(this, position(output));
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    // Linear interpolation between two sets of outputs (`from` at 0, `to` at 1)
+    static OutputValues interpolate(const OutputValues &from, const OutputValues &to,
+                                    double fraction) {
+      OutputValues result;
+      for (std::size_t s = 0; s < Surface::NUM_SURFACE_TYPES; s++) {
+        for (std::size_t o = 0; o < NUM_OUTPUT_TYPES; o++) {
+          const double a = from.values[s][o];
+          result.values[s][o] = a + fraction * (to.values[s][o] - a);
+        }
+      }
+      return result;
+    }
+
+    // All values, contiguous (e.g., for checkpoints)
+    double *data() { return &values[0][0]; }
+    const double *data() const { return &values[0][0]; }
+    std::size_t size() const { return Surface::NUM_SURFACE_TYPES * NUM_OUTPUT_TYPES; }
+
+  private:
+    template <typename, typename> friend class KeyedArrayIterator;
+
+    std::size_t position(const key_type &output) const {
+      return count(output) ? output.first * NUM_OUTPUT_TYPES + output.second : size();
+    }
+    static key_type keyAt(std::size_t position) {
+      return key_type(static_cast<Surface::SurfaceType>(position / NUM_OUTPUT_TYPES),
+                      static_cast<OutputType>(position % NUM_OUTPUT_TYPES));
+    }
+    double &valueAt(std::size_t position) {
+      return values[position / NUM_OUTPUT_TYPES][position % NUM_OUTPUT_TYPES];
+    }
+    const double &valueAt(std::size_t position) const {
+      return values[position / NUM_OUTPUT_TYPES][position % NUM_OUTPUT_TYPES];
+    }
+
+    std::array<std::array<double, NUM_OUTPUT_TYPES>, Surface::NUM_SURFACE_TYPES> values;
+  };
 
   typedef std::vector<Surface::SurfaceType> OutputMap;
 
@@ -31,7 +123,7 @@ public:
 
   OutputMap outputMap;
 
-  std::map<std::pair<Surface::SurfaceType, OutputType>, double> outputValues;
+  OutputValues outputValues;
 };
 
 } // namespace Kiva
@@ -47,4 +47,11 @@ void Instance::calculate_surface_averages() {
 	ground->calculateSurfaceAverages();
 }
 
+MemoryReport Instance::memoryReport() const {
+  if (!ground) {
+    return MemoryReport();
+  }
+  return ground->memoryReport();
+}
+
 } // namespace Kiva
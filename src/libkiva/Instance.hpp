@@ -17,6 +17,7 @@ public:
   void create();
   void calculate(double ts = 0.0);
   void calculate_surface_averages();
+  MemoryReport memoryReport() const;
   std::shared_ptr<Ground> ground;
   std::shared_ptr<Foundation> foundation;
   std::shared_ptr<BoundaryConditions> bcs;
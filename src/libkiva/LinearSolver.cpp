@@ -0,0 +1,53 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef LinearSolver_CPP
+#define LinearSolver_CPP
+
+#include "LinearSolver.hpp"
+
+namespace Kiva {
+
+void SparseLUSolver::analyzePattern(const Eigen::SparseMatrix<double> &A) {
+  solver.analyzePattern(A);
+}
+
+void SparseLUSolver::factorize(const Eigen::SparseMatrix<double> &A) { solver.factorize(A); }
+
+void SparseLUSolver::solveWithGuess(const Eigen::VectorXd &b,
+                                    const Eigen::Ref<const Eigen::VectorXd> & /*x0*/,
+                                    Eigen::Ref<Eigen::VectorXd> x) {
+  x = solver.solve(b);
+}
+
+Eigen::ComputationInfo SparseLUSolver::info() const { return solver.info(); }
+
+std::shared_ptr<LinearSolver> makeLinearSolver(Foundation::LinearSolverType type,
+                                               const Domain &domain) {
+  typedef Eigen::SparseMatrix<double> Matrix;
+  switch (type) {
+  case Foundation::LS_BICGSTAB_JACOBI:
+    return std::make_shared<IterativeLinearSolver<BiCGSTAB<Matrix, JacobiPreconditioner>>>();
+  case Foundation::LS_GMRES_ILUT:
+    return std::make_shared<
+        IterativeLinearSolver<Eigen::GMRES<Matrix, IncompleteLUTPreconditioner>>>();
+  case Foundation::LS_SPARSE_LU:
+    return std::make_shared<SparseLUSolver>();
+  case Foundation::LS_BICGSTAB_MULTIGRID: {
+    auto solver =
+        std::make_shared<IterativeLinearSolver<BiCGSTAB<Matrix, MultigridPreconditioner>>>();
+    solver->preconditioner().setGrid(domain.mesh[0].centers, domain.mesh[1].centers,
+                                     domain.mesh[2].centers);
+    solver->preconditioner().setActiveCells(domain.activeCells);
+    return solver;
+  }
+  case Foundation::LS_BICGSTAB_ILUT:
+  default:
+    return std::make_shared<
+        IterativeLinearSolver<BiCGSTAB<Matrix, IncompleteLUTPreconditioner>>>();
+  }
+}
+
+} // namespace Kiva
+
+#endif
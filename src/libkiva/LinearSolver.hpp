@@ -0,0 +1,125 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef LinearSolver_HPP
+#define LinearSolver_HPP
+
+#include "BiCGSTAB.hpp"
+#include "Domain.hpp"
+#include "Foundation.hpp"
+#include "MemoryReport.hpp"
+#include "Multigrid.hpp"
+#include "libkiva_export.h"
+
+#include <memory>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <unsupported/Eigen/IterativeSolvers>
+
+namespace Kiva {
+
+// Common interface for the sparse linear solvers used by the implicit, Crank-Nicolson and
+// steady-state schemes. The solver keeps a reference to the matrix passed to analyzePattern and
+// factorize, so the matrix must outlive the factorization.
+class LIBKIVA_EXPORT LinearSolver {
+public:
+  virtual ~LinearSolver() {}
+
+  virtual void setMaxIterations(int maxIterations) = 0;
+  virtual void setTolerance(double tolerance) = 0;
+
+  // Called when the sparsity pattern of the matrix changes
+  virtual void analyzePattern(const Eigen::SparseMatrix<double> &A) = 0;
+  // Called when the values of the matrix change (computes the preconditioner or factorization)
+  virtual void factorize(const Eigen::SparseMatrix<double> &A) = 0;
+
+  // Writes the solution to x, which may map onto existing storage
+  virtual void solveWithGuess(const Eigen::VectorXd &b, const Eigen::Ref<const Eigen::VectorXd> &x0,
+                              Eigen::Ref<Eigen::VectorXd> x) = 0;
+
+  virtual Eigen::ComputationInfo info() const = 0;
+  virtual int iterations() const = 0;
+  virtual double error() const = 0;
+
+  // Direct solvers are only valid for the exact matrix they factorized. Iterative solvers may
+  // reuse a preconditioner computed for a different matrix.
+  virtual bool isDirect() const = 0;
+
+  // Bytes held by the preconditioner or factorization
+  virtual std::size_t memoryUsage() const = 0;
+};
+
+// Eigen's solvers return an expression that is evaluated into x
+template <typename EigenSolver>
+void solveIteratively(EigenSolver &solver, const Eigen::VectorXd &b,
+                      const Eigen::Ref<const Eigen::VectorXd> &x0, Eigen::Ref<Eigen::VectorXd> x) {
+  x = solver.solveWithGuess(b, x0);
+}
+
+template <typename MatrixType, typename Preconditioner>
+void solveIteratively(BiCGSTAB<MatrixType, Preconditioner> &solver, const Eigen::VectorXd &b,
+                      const Eigen::Ref<const Eigen::VectorXd> &x0, Eigen::Ref<Eigen::VectorXd> x) {
+  solver.solveWithGuess(b, x0, x);
+}
+
+// Wraps a preconditioned Krylov solver (Kiva's BiCGSTAB or one from Eigen)
+template <typename EigenSolver> class IterativeLinearSolver : public LinearSolver {
+public:
+  void setMaxIterations(int maxIterations) { solver.setMaxIterations(maxIterations); }
+  void setTolerance(double tolerance) { solver.setTolerance(tolerance); }
+
+  void analyzePattern(const Eigen::SparseMatrix<double> &A) { solver.analyzePattern(A); }
+  void factorize(const Eigen::SparseMatrix<double> &A) { solver.factorize(A); }
+
+  void solveWithGuess(const Eigen::VectorXd &b, const Eigen::Ref<const Eigen::VectorXd> &x0,
+                      Eigen::Ref<Eigen::VectorXd> x) {
+    solveIteratively(solver, b, x0, x);
+  }
+
+  Eigen::ComputationInfo info() const { return solver.info(); }
+  int iterations() const { return static_cast<int>(solver.iterations()); }
+  double error() const { return solver.error(); }
+
+  bool isDirect() const { return false; }
+
+  std::size_t memoryUsage() const { return solver.preconditioner().memoryUsage(); }
+
+  typename EigenSolver::Preconditioner &preconditioner() { return solver.preconditioner(); }
+
+private:
+  EigenSolver solver;
+};
+
+// Sparse LU factorization. The symbolic analysis is kept while the sparsity pattern is unchanged,
+// and the numerical factorization is reused for as long as the matrix values are unchanged.
+class LIBKIVA_EXPORT SparseLUSolver : public LinearSolver {
+public:
+  void setMaxIterations(int) {}
+  void setTolerance(double) {}
+
+  void analyzePattern(const Eigen::SparseMatrix<double> &A);
+  void factorize(const Eigen::SparseMatrix<double> &A);
+
+  void solveWithGuess(const Eigen::VectorXd &b, const Eigen::Ref<const Eigen::VectorXd> &x0,
+                      Eigen::Ref<Eigen::VectorXd> x);
+
+  Eigen::ComputationInfo info() const;
+  int iterations() const { return 1; }
+  double error() const { return 0.0; }
+
+  bool isDirect() const { return true; }
+
+  std::size_t memoryUsage() const { return solver.memoryUsage(); }
+
+private:
+  SparseLUFactorization solver;
+};
+
+std::shared_ptr<LinearSolver> LIBKIVA_EXPORT makeLinearSolver(Foundation::LinearSolverType type,
+                                                              const Domain &domain);
+
+} // namespace Kiva
+
+#endif
@@ -0,0 +1,86 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef MemoryReport_CPP
+#define MemoryReport_CPP
+
+#include "MemoryReport.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace Kiva {
+
+void MemoryReport::add(const std::string &component, std::size_t bytes) {
+  for (auto &entry : components) {
+    if (entry.first == component) {
+      entry.second += bytes;
+      return;
+    }
+  }
+  components.emplace_back(component, bytes);
+}
+
+void MemoryReport::add(const MemoryReport &report) {
+  for (auto &entry : report.components) {
+    add(entry.first, entry.second);
+  }
+}
+
+std::size_t MemoryReport::total() const {
+  std::size_t bytes = 0;
+  for (auto &entry : components) {
+    bytes += entry.second;
+  }
+  return bytes;
+}
+
+std::string MemoryReport::toString() const {
+  std::size_t width = 5;
+  for (auto &entry : components) {
+    width = std::max(width, entry.first.size());
+  }
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(1);
+  for (auto &entry : components) {
+    ss << "  " << std::left << std::setw(width) << entry.first << "  " << std::right
+       << std::setw(12) << entry.second / 1024.0 << " KiB\n";
+  }
+  ss << "  " << std::left << std::setw(width) << "Total"
+     << "  " << std::right << std::setw(12) << total() / 1024.0 << " KiB";
+  return ss.str();
+}
+
+std::size_t IncompleteLUTPreconditioner::memoryUsage() const {
+  return Kiva::memoryUsage(m_lu) +
+         static_cast<std::size_t>(m_P.indices().size() + m_Pinv.indices().size()) *
+             sizeof(StorageIndex);
+}
+
+void IncompleteLUTPreconditioner::apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const {
+  // The steps of Eigen::IncompleteLUT::solve, without its in-place permutation (which allocates)
+  work.resize(b.size());
+  work = m_Pinv * b;
+  m_lu.triangularView<Eigen::UnitLower>().solveInPlace(work);
+  m_lu.triangularView<Eigen::Upper>().solveInPlace(work);
+  x = m_P * work;
+}
+
+std::size_t JacobiPreconditioner::memoryUsage() const { return Kiva::memoryUsage(m_invdiag); }
+
+std::size_t SparseLUFactorization::memoryUsage() const {
+  // L and U are stored in m_glu (m_Lstore and m_Ustore map onto it)
+  std::size_t bytes = Kiva::memoryUsage(m_mat) + Kiva::memoryUsage(m_etree) +
+                      Kiva::memoryUsage(m_perm_c.indices()) +
+                      Kiva::memoryUsage(m_perm_r.indices());
+  bytes += Kiva::memoryUsage(m_glu.xsup) + Kiva::memoryUsage(m_glu.supno) +
+           Kiva::memoryUsage(m_glu.lusup) + Kiva::memoryUsage(m_glu.lsub) +
+           Kiva::memoryUsage(m_glu.xlusup) + Kiva::memoryUsage(m_glu.xlsub) +
+           Kiva::memoryUsage(m_glu.ucol) + Kiva::memoryUsage(m_glu.usub) +
+           Kiva::memoryUsage(m_glu.xusub);
+  return bytes;
+}
+
+} // namespace Kiva
+
+#endif
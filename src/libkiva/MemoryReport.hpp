@@ -0,0 +1,89 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef MemoryReport_HPP
+#define MemoryReport_HPP
+
+#include "libkiva_export.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+namespace Kiva {
+
+// Bytes of heap storage held by an object, by component. Sizes are the capacities of the
+// containers (excluding allocator overhead), so the report of an object does not change between
+// timesteps once its data structures are built.
+class LIBKIVA_EXPORT MemoryReport {
+public:
+  // Adds to the bytes of a component (appended if not already in the report)
+  void add(const std::string &component, std::size_t bytes);
+  // Adds each component of another report
+  void add(const MemoryReport &report);
+
+  std::size_t total() const;
+
+  // One line per component and the total, in KiB
+  std::string toString() const;
+
+  std::vector<std::pair<std::string, std::size_t>> components; // in order of addition
+};
+
+template <typename T> std::size_t memoryUsage(const std::vector<T> &v) {
+  return v.capacity() * sizeof(T);
+}
+
+template <typename Derived> std::size_t memoryUsage(const Eigen::PlainObjectBase<Derived> &m) {
+  return static_cast<std::size_t>(m.size()) * sizeof(typename Derived::Scalar);
+}
+
+template <typename Scalar, int Options, typename StorageIndex>
+std::size_t memoryUsage(const Eigen::SparseMatrix<Scalar, Options, StorageIndex> &m) {
+  std::size_t outer = static_cast<std::size_t>(m.outerSize());
+  std::size_t bytes = static_cast<std::size_t>(m.data().allocatedSize()) *
+                          (sizeof(Scalar) + sizeof(StorageIndex)) +
+                      (outer + 1) * sizeof(StorageIndex);
+  if (!m.isCompressed()) {
+    bytes += outer * sizeof(StorageIndex); // inner nonzero counts
+  }
+  return bytes;
+}
+
+// Eigen factorizations and preconditioners that report the size of their factors. The
+// preconditioners also apply themselves without allocating (see BiCGSTAB.hpp).
+
+class LIBKIVA_EXPORT IncompleteLUTPreconditioner : public Eigen::IncompleteLUT<double> {
+public:
+  std::size_t memoryUsage() const;
+
+  void apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const;
+
+private:
+  mutable Eigen::VectorXd work; // permuted right-hand side and solution
+};
+
+class LIBKIVA_EXPORT JacobiPreconditioner : public Eigen::DiagonalPreconditioner<double> {
+public:
+  std::size_t memoryUsage() const;
+
+  void apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const {
+    x = m_invdiag.cwiseProduct(b);
+  }
+};
+
+class LIBKIVA_EXPORT SparseLUFactorization
+    : public Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> {
+public:
+  std::size_t memoryUsage() const;
+};
+
+} // namespace Kiva
+
+#endif
@@ -5,6 +5,7 @@
 #define Mesher_CPP
 
 #include "Mesher.hpp"
+#include "MemoryReport.hpp"
 
 namespace Kiva {
 
@@ -234,6 +235,11 @@ std::size_t Mesher::getPreviousIndex(double position) {
     return -1;
   }
 }
+
+std::size_t Mesher::memoryUsage() const {
+  return Kiva::memoryUsage(dividers) + Kiva::memoryUsage(deltas) + Kiva::memoryUsage(centers) +
+         Kiva::memoryUsage(data.points) + Kiva::memoryUsage(data.intervals);
+}
 } // namespace Kiva
 
 #endif
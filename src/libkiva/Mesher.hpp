@@ -41,6 +41,7 @@ public:
   std::size_t getNearestIndex(double position);
   std::size_t getNextIndex(double position);
   std::size_t getPreviousIndex(double position);
+  std::size_t memoryUsage() const;
 };
 
 } // namespace Kiva
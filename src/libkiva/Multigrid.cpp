@@ -0,0 +1,327 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef Multigrid_CPP
+#define Multigrid_CPP
+
+#include "Multigrid.hpp"
+
+namespace Kiva {
+
+static const std::size_t MAX_LEVELS = 20;
+
+// Merge pairs of cells along one axis and return the interpolation weights from coarse to fine
+// cells as (fine, coarse, weight) triplets
+static std::vector<double> coarsenAxis(const std::vector<double> &fine,
+                                       std::vector<Eigen::Triplet<double>> &weights) {
+  const std::size_t nf = fine.size();
+  weights.clear();
+  if (nf <= 2) {
+    for (std::size_t i = 0; i < nf; i++) {
+      weights.emplace_back(i, i, 1.0);
+    }
+    return fine;
+  }
+
+  const std::size_t nc = (nf + 1) / 2;
+  std::vector<double> coarse(nc);
+  for (std::size_t I = 0; I < nc; I++) {
+    coarse[I] = 2 * I + 1 < nf ? 0.5 * (fine[2 * I] + fine[2 * I + 1]) : fine[2 * I];
+  }
+
+  for (std::size_t i = 0; i < nf; i++) {
+    std::size_t I = i / 2;
+    std::size_t lo = I, hi = I;
+    if (fine[i] < coarse[I] && I > 0) {
+      lo = I - 1;
+    } else if (fine[i] > coarse[I] && I + 1 < nc) {
+      hi = I + 1;
+    }
+    double span = coarse[hi] - coarse[lo];
+    if (lo == hi || span <= 0.0) {
+      weights.emplace_back(i, I, 1.0);
+    } else {
+      double w = (fine[i] - coarse[lo]) / span;
+      weights.emplace_back(i, lo, 1.0 - w);
+      weights.emplace_back(i, hi, w);
+    }
+  }
+  return coarse;
+}
+
+MultigridPreconditioner::MultigridPreconditioner()
+    : maxCoarseCells(500), smoothingSweeps(2), status(Eigen::Success) {}
+
+void MultigridPreconditioner::setGrid(const std::vector<double> &xCenters,
+                                      const std::vector<double> &yCenters,
+                                      const std::vector<double> &zCenters) {
+  centers[0] = xCenters;
+  centers[1] = yCenters;
+  centers[2] = zCenters;
+}
+
+void MultigridPreconditioner::setActiveCells(const std::vector<CellIndex> &cells) {
+  activeCells = cells;
+}
+
+void MultigridPreconditioner::buildHierarchy(std::size_t size) {
+  prolongations.clear();
+  restrictions.clear();
+  gridSizes.clear();
+
+  std::vector<double> fine[3] = {centers[0], centers[1], centers[2]};
+  const std::size_t gridSize = fine[0].size() * fine[1].size() * fine[2].size();
+  if (activeCells.empty() ? gridSize != size : activeCells.size() != size) {
+    // No grid is available for this system: solve it directly
+    return;
+  }
+
+  while (prolongations.size() + 1 < MAX_LEVELS) {
+    std::size_t nf[3], nc[3];
+    std::vector<double> coarse[3];
+    std::vector<Eigen::Triplet<double>> axisWeights[3];
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      nf[dim] = fine[dim].size();
+      coarse[dim] = coarsenAxis(fine[dim], axisWeights[dim]);
+      nc[dim] = coarse[dim].size();
+    }
+
+    const std::size_t fineSize = nf[0] * nf[1] * nf[2];
+    const std::size_t coarseSize = nc[0] * nc[1] * nc[2];
+    if (fineSize <= maxCoarseCells || coarseSize == fineSize) {
+      break;
+    }
+    gridSizes.push_back({{nf[0], nf[1], nf[2]}});
+
+    // Tensor product of the interpolation along each axis
+    std::vector<Eigen::Triplet<double>> weights;
+    for (const auto &wz : axisWeights[2]) {
+      for (const auto &wy : axisWeights[1]) {
+        for (const auto &wx : axisWeights[0]) {
+          std::size_t row = wx.row() + nf[0] * wy.row() + nf[0] * nf[1] * wz.row();
+          std::size_t col = wx.col() + nc[0] * wy.col() + nc[0] * nc[1] * wz.col();
+          weights.emplace_back(row, col, wx.value() * wy.value() * wz.value());
+        }
+      }
+    }
+    Eigen::SparseMatrix<double> P(fineSize, coarseSize);
+    P.setFromTriplets(weights.begin(), weights.end());
+    restrictions.push_back(P.transpose());
+    prolongations.push_back(P);
+
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      fine[dim].swap(coarse[dim]);
+    }
+  }
+}
+
+void MultigridPreconditioner::computeOperators(const Eigen::SparseMatrix<double> &matrix) {
+  Eigen::SparseMatrix<double> A;
+  if (!activeCells.empty() && !prolongations.empty()) {
+    // Embed the system in the grid. Cells that are not in the system keep a zero correction.
+    const std::size_t gridSize = prolongations[0].rows();
+    std::vector<bool> inactive(gridSize, true);
+    std::vector<Eigen::Triplet<double>> entries;
+    entries.reserve(matrix.nonZeros() + gridSize - activeCells.size());
+    for (Eigen::Index col = 0; col < matrix.outerSize(); col++) {
+      inactive[activeCells[col]] = false;
+      for (Eigen::SparseMatrix<double>::InnerIterator it(matrix, col); it; ++it) {
+        entries.emplace_back(activeCells[it.row()], activeCells[col], it.value());
+      }
+    }
+    for (std::size_t cell = 0; cell < gridSize; cell++) {
+      if (inactive[cell]) {
+        entries.emplace_back(cell, cell, 1.0);
+      }
+    }
+    A.resize(gridSize, gridSize);
+    A.setFromTriplets(entries.begin(), entries.end());
+  } else {
+    A = matrix;
+  }
+
+  // Rows are scaled by their diagonal so that equations with very different magnitudes (e.g.,
+  // fixed temperatures, surface convection and conduction) are combined consistently on coarse
+  // levels. Line Gauss-Seidel smoothing is unaffected by the scaling.
+  rowScale.resize(A.rows());
+  rowScale.setOnes();
+  Eigen::VectorXd diagonal = A.diagonal();
+  for (Eigen::Index i = 0; i < A.rows(); i++) {
+    if (diagonal[i] != 0.0) {
+      rowScale[i] = 1.0 / diagonal[i];
+    }
+  }
+
+  operators.resize(prolongations.size() + 1);
+  operators[0] = rowScale.asDiagonal() * A;
+  for (std::size_t level = 0; level < prolongations.size(); level++) {
+    Eigen::SparseMatrix<double> AP = operators[level] * prolongations[level];
+    operators[level + 1] = restrictions[level] * AP;
+  }
+
+  Eigen::SparseMatrix<double> coarsest = operators.back();
+  coarsest.makeCompressed();
+  coarseSolver.compute(coarsest);
+  status = coarseSolver.info();
+
+  allocateWork();
+}
+
+void MultigridPreconditioner::allocateWork() {
+  const std::size_t numLevels = operators.size();
+  levelB.resize(numLevels);
+  levelX.resize(numLevels);
+  residuals.resize(numLevels);
+  std::size_t maxLength = 0;
+  for (std::size_t level = 0; level < numLevels; level++) {
+    const Eigen::Index size = operators[level].rows();
+    levelB[level].setZero(size);
+    levelX[level].setZero(size);
+    residuals[level].setZero(level + 1 < numLevels ? size : 0);
+    if (level < gridSizes.size()) {
+      for (std::size_t dim = 0; dim < 3; dim++) {
+        maxLength = std::max(maxLength, gridSizes[level][dim]);
+      }
+    }
+  }
+  lineLower.resize(maxLength);
+  lineDiagonal.resize(maxLength);
+  lineUpper.resize(maxLength);
+  lineRhs.resize(maxLength);
+}
+
+std::size_t MultigridPreconditioner::memoryUsage() const {
+  std::size_t bytes = Kiva::memoryUsage(activeCells) + Kiva::memoryUsage(rowScale) +
+                      Kiva::memoryUsage(gridSizes) + coarseSolver.memoryUsage();
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    bytes += Kiva::memoryUsage(centers[dim]);
+  }
+  for (std::size_t level = 0; level < operators.size(); level++) {
+    bytes += Kiva::memoryUsage(operators[level]);
+  }
+  for (std::size_t level = 0; level < prolongations.size(); level++) {
+    bytes += Kiva::memoryUsage(prolongations[level]) + Kiva::memoryUsage(restrictions[level]);
+  }
+  for (std::size_t level = 0; level < levelB.size(); level++) {
+    bytes += Kiva::memoryUsage(levelB[level]) + Kiva::memoryUsage(levelX[level]) +
+             Kiva::memoryUsage(residuals[level]);
+  }
+  bytes += Kiva::memoryUsage(lineLower) + Kiva::memoryUsage(lineDiagonal) +
+           Kiva::memoryUsage(lineUpper) + Kiva::memoryUsage(lineRhs);
+  return bytes;
+}
+
+void MultigridPreconditioner::apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const {
+  if (activeCells.empty() || prolongations.empty()) {
+    // The system rows are the grid cells, or the system is solved directly
+    levelB[0] = rowScale.cwiseProduct(b);
+    vCycle(0);
+    x = levelX[0];
+    return;
+  }
+  Eigen::VectorXd &gridB = levelB[0];
+  gridB.setZero();
+  for (std::size_t row = 0; row < activeCells.size(); row++) {
+    gridB[activeCells[row]] = rowScale[activeCells[row]] * b[row];
+  }
+  vCycle(0);
+  const Eigen::VectorXd &gridX = levelX[0];
+  for (std::size_t row = 0; row < activeCells.size(); row++) {
+    x[row] = gridX[activeCells[row]];
+  }
+}
+
+void MultigridPreconditioner::vCycle(std::size_t level) const {
+  const Eigen::VectorXd &b = levelB[level];
+  Eigen::VectorXd &x = levelX[level];
+  if (level + 1 == operators.size()) {
+    x = coarseSolver.solve(b);
+    return;
+  }
+
+  const RowMatrix &A = operators[level];
+  x.setZero();
+  for (int sweep = 0; sweep < smoothingSweeps; sweep++) {
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      lineGaussSeidel(level, dim, b, x, true);
+    }
+  }
+
+  Eigen::VectorXd &residual = residuals[level];
+  residual = b;
+  residual.noalias() -= A * x;
+  levelB[level + 1].noalias() = restrictions[level] * residual;
+  vCycle(level + 1);
+  x.noalias() += prolongations[level] * levelX[level + 1];
+
+  // Sweeping in the opposite order keeps the cycle symmetric for symmetric systems
+  for (int sweep = 0; sweep < smoothingSweeps; sweep++) {
+    for (std::size_t dim = 3; dim-- > 0;) {
+      lineGaussSeidel(level, dim, b, x, false);
+    }
+  }
+}
+
+void MultigridPreconditioner::lineGaussSeidel(std::size_t level, std::size_t dim,
+                                              const Eigen::VectorXd &b, Eigen::VectorXd &x,
+                                              bool forward) const {
+  const RowMatrix &A = operators[level];
+  const std::array<std::size_t, 3> &n = gridSizes[level];
+  const std::size_t length = n[dim];
+  if (length < 2) {
+    return;
+  }
+  const std::size_t stride[3] = {1, n[0], n[0] * n[1]};
+  const std::size_t step = stride[dim];
+  const std::size_t numLines = n[0] * n[1] * n[2] / length;
+
+  std::vector<double> &lower = lineLower, &diagonal = lineDiagonal, &upper = lineUpper,
+                      &rhs = lineRhs;
+  for (std::size_t l = 0; l < numLines; l++) {
+    const std::size_t line = forward ? l : numLines - 1 - l;
+    // First cell of the line: remove the coordinate along `dim` from the line number
+    const std::size_t first = (line / step) * step * length + line % step;
+
+    // Couplings to cells outside of the line use the latest values
+    for (std::size_t m = 0; m < length; m++) {
+      const Eigen::Index i = first + m * step;
+      double sum = b[i];
+      lower[m] = diagonal[m] = upper[m] = 0.0;
+      for (RowMatrix::InnerIterator it(A, i); it; ++it) {
+        const Eigen::Index j = it.col();
+        if (j == i) {
+          diagonal[m] = it.value();
+        } else if (m > 0 && j == i - static_cast<Eigen::Index>(step)) {
+          lower[m] = it.value();
+        } else if (m + 1 < length && j == i + static_cast<Eigen::Index>(step)) {
+          upper[m] = it.value();
+        } else {
+          sum -= it.value() * x[j];
+        }
+      }
+      if (diagonal[m] == 0.0) {
+        // Leave the cell unchanged
+        diagonal[m] = 1.0;
+        lower[m] = upper[m] = 0.0;
+        sum = x[i];
+      }
+      rhs[m] = sum;
+    }
+
+    // Thomas algorithm
+    for (std::size_t m = 1; m < length; m++) {
+      const double factor = lower[m] / diagonal[m - 1];
+      diagonal[m] -= factor * upper[m - 1];
+      rhs[m] -= factor * rhs[m - 1];
+    }
+    x[first + (length - 1) * step] = rhs[length - 1] / diagonal[length - 1];
+    for (std::size_t m = length - 1; m-- > 0;) {
+      rhs[m] = (rhs[m] - upper[m] * x[first + (m + 1) * step]) / diagonal[m];
+      x[first + m * step] = rhs[m];
+    }
+  }
+}
+
+} // namespace Kiva
+
+#endif
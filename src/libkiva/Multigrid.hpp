@@ -0,0 +1,100 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef Multigrid_HPP
+#define Multigrid_HPP
+
+#include "Functions.hpp"
+#include "MemoryReport.hpp"
+#include "libkiva_export.h"
+
+#include <array>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+namespace Kiva {
+
+// Geometric multigrid V-cycle for systems on the tensor-product mesh, used as a preconditioner for
+// Eigen's iterative solvers. Coarse grids merge pairs of neighboring cells along each axis.
+// Corrections are interpolated linearly between coarse cell centers, and coarse operators are
+// formed from the fine operator (Galerkin products), so material discontinuities, zero-thickness
+// cells and boundary rows are represented on every level without rediscretizing the domain.
+// Each level is smoothed with alternating-direction line Gauss-Seidel (a tridiagonal solve per
+// line of cells), which remains effective on the strongly graded meshes near foundation surfaces.
+// The coarsest system is solved with a sparse LU factorization. Systems that only hold some of the
+// grid cells (see setActiveCells) are embedded in the grid with identity rows for the other cells.
+class LIBKIVA_EXPORT MultigridPreconditioner {
+public:
+  MultigridPreconditioner();
+
+  // Cell centers along each axis. Cells are indexed as i + nX*j + nX*nY*k.
+  void setGrid(const std::vector<double> &xCenters, const std::vector<double> &yCenters,
+               const std::vector<double> &zCenters);
+
+  // Grid cells of the system rows, in row order. All cells are rows if this is empty.
+  void setActiveCells(const std::vector<CellIndex> &cells);
+
+  template <typename MatrixType> MultigridPreconditioner &analyzePattern(const MatrixType &A) {
+    buildHierarchy(static_cast<std::size_t>(A.rows()));
+    return *this;
+  }
+
+  template <typename MatrixType> MultigridPreconditioner &factorize(const MatrixType &A) {
+    computeOperators(Eigen::SparseMatrix<double>(A));
+    return *this;
+  }
+
+  template <typename MatrixType> MultigridPreconditioner &compute(const MatrixType &A) {
+    analyzePattern(A);
+    return factorize(A);
+  }
+
+  template <typename Rhs> Eigen::VectorXd solve(const Rhs &b) const {
+    Eigen::VectorXd x(b.size());
+    apply(b, x);
+    return x;
+  }
+
+  // Writes the V-cycle approximation of A^-1*b to x, using the work vectors sized by factorize.
+  // Only the sparse LU solve of the coarsest system allocates (inside Eigen).
+  void apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const;
+
+  Eigen::ComputationInfo info() { return status; }
+
+  std::size_t numberOfLevels() const { return operators.size(); }
+
+  std::size_t memoryUsage() const; // bytes held by the hierarchy
+
+  std::size_t maxCoarseCells; // stop coarsening at this many cells
+  int smoothingSweeps; // line Gauss-Seidel sweeps before and after each coarse correction
+
+private:
+  typedef Eigen::SparseMatrix<double, Eigen::RowMajor> RowMatrix;
+
+  void buildHierarchy(std::size_t size);
+  void computeOperators(const Eigen::SparseMatrix<double> &matrix);
+  void allocateWork();
+  void vCycle(std::size_t level) const; // solves levelB[level] into levelX[level]
+  void lineGaussSeidel(std::size_t level, std::size_t dim, const Eigen::VectorXd &b,
+                       Eigen::VectorXd &x, bool forward) const;
+
+  std::vector<double> centers[3];
+  std::vector<CellIndex> activeCells;
+
+  std::vector<std::array<std::size_t, 3>> gridSizes;     // cells along each axis, per level
+  std::vector<Eigen::SparseMatrix<double>> prolongations; // from level l + 1 to level l
+  std::vector<Eigen::SparseMatrix<double>> restrictions;  // from level l to level l + 1
+  std::vector<RowMatrix> operators;                       // one per level, finest first
+  Eigen::VectorXd rowScale;                               // applied to the finest level rows
+  SparseLUFactorization coarseSolver;
+  Eigen::ComputationInfo status;
+
+  // Work vectors, per level, and line buffers of the smoother
+  mutable std::vector<Eigen::VectorXd> levelB, levelX, residuals;
+  mutable std::vector<double> lineLower, lineDiagonal, lineUpper, lineRhs;
+};
+
+} // namespace Kiva
+
+#endif
@@ -0,0 +1,71 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StateIO_CPP
+#define StateIO_CPP
+
+#include "StateIO.hpp"
+#include "Errors.hpp"
+
+namespace Kiva {
+
+static_assert(sizeof(double) == 8, "State records require 8-byte doubles");
+
+StateWriter::StateWriter(std::ostream &out) : out(out) {}
+
+void StateWriter::write(double value) { out.write(reinterpret_cast<const char *>(&value), 8); }
+
+void StateWriter::writeInteger(std::int64_t value) {
+  out.write(reinterpret_cast<const char *>(&value), 8);
+}
+
+void StateWriter::write(const double *values, std::size_t size) {
+  writeInteger(static_cast<std::int64_t>(size));
+  out.write(reinterpret_cast<const char *>(values), size * 8);
+}
+
+StateReader::StateReader(std::istream &in, const std::string &name) : in(in), name(name) {}
+
+void StateReader::check() {
+  if (!in) {
+    showMessage(MSG_ERR, "Unable to read " + name + ".");
+  }
+}
+
+double StateReader::read() {
+  double value = 0.0;
+  in.read(reinterpret_cast<char *>(&value), 8);
+  check();
+  return value;
+}
+
+std::int64_t StateReader::readInteger() {
+  std::int64_t value = 0;
+  in.read(reinterpret_cast<char *>(&value), 8);
+  check();
+  return value;
+}
+
+void StateReader::read(double *values, std::size_t size) {
+  if (readSize() != size) {
+    showMessage(MSG_ERR, "The size of an array in " + name + " does not match the model.");
+  }
+  readValues(values, size);
+}
+
+std::size_t StateReader::readSize() {
+  std::int64_t size = readInteger();
+  if (size < 0) {
+    showMessage(MSG_ERR, "Unable to read " + name + ".");
+  }
+  return static_cast<std::size_t>(size);
+}
+
+void StateReader::readValues(double *values, std::size_t size) {
+  in.read(reinterpret_cast<char *>(values), size * 8);
+  check();
+}
+
+} // namespace Kiva
+
+#endif
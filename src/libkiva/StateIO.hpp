@@ -0,0 +1,58 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StateIO_HPP
+#define StateIO_HPP
+
+#include "libkiva_export.h"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Kiva {
+
+// Binary records of simulation state (checkpoints). Every value is 8 bytes in its native
+// representation, and arrays are stored as their size followed by their values, so each array
+// starts at an 8-byte aligned offset in the file and can be used directly from a memory mapping.
+// Records are only read back on a machine with the same byte order.
+class LIBKIVA_EXPORT StateWriter {
+public:
+  explicit StateWriter(std::ostream &out);
+
+  void write(double value);
+  void writeInteger(std::int64_t value);
+  void write(const double *values, std::size_t size);
+  void write(const std::vector<double> &values) { write(values.data(), values.size()); }
+
+  bool good() const { return out.good(); }
+
+private:
+  std::ostream &out;
+};
+
+// Reads records written by StateWriter. Any failure (including a size that differs from the
+// expected one) is reported as an error naming the record.
+class LIBKIVA_EXPORT StateReader {
+public:
+  StateReader(std::istream &in, const std::string &name);
+
+  double read();
+  std::int64_t readInteger();
+  void read(double *values, std::size_t size);
+  void read(std::vector<double> &values) { read(values.data(), values.size()); }
+  std::size_t readSize(); // of an array of any size (read its values with readValues)
+  void readValues(double *values, std::size_t size);
+
+private:
+  std::istream &in;
+  std::string name;
+
+  void check();
+};
+
+} // namespace Kiva
+
+#endif // StateIO_HPP
@@ -0,0 +1,123 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StencilOperator_CPP
+#define StencilOperator_CPP
+
+#include "StencilOperator.hpp"
+
+namespace Kiva {
+
+void StencilOperator::resize(std::size_t num_cells, const std::size_t (&stepsize_in)[3],
+                             const std::size_t (&dim_lengths_in)[3]) {
+  size = num_cells;
+  diagonal.assign(size, 0.0);
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    stepsize[dim] = stepsize_in[dim];
+    dim_lengths[dim] = dim_lengths_in[dim];
+    for (std::size_t dir = 0; dir < 2; dir++) {
+      if (dim_lengths[dim] > 1) {
+        neighbor[dim][dir].assign(size, 0.0);
+      } else {
+        neighbor[dim][dir].clear();
+      }
+    }
+  }
+}
+
+void StencilOperator::multiplyAdd(double alpha, const double *x, double *y) const {
+  const std::ptrdiff_t n = size;
+
+#pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t index = 0; index < n; ++index) {
+    double sum = diagonal[index] * x[index];
+    for (std::size_t dim = 0; dim < 3; dim++) {
+      if (neighbor[dim][0].empty()) {
+        continue;
+      }
+      const std::ptrdiff_t step = stepsize[dim];
+      // Coefficients are zero where the neighbor is outside of the domain
+      if (index >= step) {
+        sum += neighbor[dim][0][index] * x[index - step];
+      }
+      if (index + step < n) {
+        sum += neighbor[dim][1][index] * x[index + step];
+      }
+    }
+    y[index] += alpha * sum;
+  }
+}
+
+std::size_t StencilOperator::memoryUsage() const {
+  std::size_t bytes = Kiva::memoryUsage(diagonal);
+  for (std::size_t dim = 0; dim < 3; dim++) {
+    bytes += Kiva::memoryUsage(neighbor[dim][0]) + Kiva::memoryUsage(neighbor[dim][1]);
+  }
+  return bytes;
+}
+
+StencilLinePreconditioner &StencilLinePreconditioner::factorize(const StencilOperator &A) {
+  op = &A;
+  upperFactor.resize(A.size);
+  invPivot.resize(A.size);
+  status = Eigen::Success;
+
+  // Lines are along Z, the slowest varying index, so each step along the lines is contiguous
+  const std::size_t lanes = A.stepsize[2];
+  const std::size_t length = A.dim_lengths[2];
+  const bool coupled = !A.neighbor[2][0].empty();
+
+  for (std::size_t k = 0; k < length; k++) {
+    for (std::size_t lane = 0; lane < lanes; lane++) {
+      const std::size_t index = k * lanes + lane;
+      double pivot = A.diagonal[index];
+      if (coupled && k > 0) {
+        pivot -= A.neighbor[2][0][index] * upperFactor[index - lanes];
+      }
+      if (pivot == 0.0) {
+        status = Eigen::NumericalIssue;
+        pivot = 1.0;
+      }
+      invPivot[index] = 1.0 / pivot;
+      upperFactor[index] = coupled ? A.neighbor[2][1][index] * invPivot[index] : 0.0;
+    }
+  }
+  return *this;
+}
+
+std::size_t StencilLinePreconditioner::memoryUsage() const {
+  return Kiva::memoryUsage(upperFactor) + Kiva::memoryUsage(invPivot);
+}
+
+void StencilLinePreconditioner::solveInPlace(double *x) const {
+  const std::size_t lanes = op->stepsize[2];
+  const std::size_t length = op->dim_lengths[2];
+
+  if (op->neighbor[2][0].empty()) {
+    for (std::size_t index = 0; index < op->size; index++) {
+      x[index] *= invPivot[index];
+    }
+    return;
+  }
+
+  const std::vector<double> &lower = op->neighbor[2][0];
+  for (std::size_t lane = 0; lane < lanes; lane++) {
+    x[lane] *= invPivot[lane];
+  }
+  for (std::size_t k = 1; k < length; k++) {
+    for (std::size_t lane = 0; lane < lanes; lane++) {
+      const std::size_t index = k * lanes + lane;
+      x[index] = (x[index] - lower[index] * x[index - lanes]) * invPivot[index];
+    }
+  }
+  for (std::size_t k = length - 1; k-- > 0;) {
+    for (std::size_t lane = 0; lane < lanes; lane++) {
+      const std::size_t index = k * lanes + lane;
+      x[index] -= upperFactor[index] * x[index + lanes];
+    }
+  }
+}
+
+} // namespace Kiva
+
+#endif
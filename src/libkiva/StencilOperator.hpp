@@ -0,0 +1,127 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#ifndef StencilOperator_HPP
+#define StencilOperator_HPP
+
+#include "MemoryReport.hpp"
+#include "libkiva_export.h"
+
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCore>
+
+namespace Kiva {
+class StencilOperator;
+}
+
+namespace Eigen {
+namespace internal {
+// StencilOperator is used in place of a SparseMatrix, so it inherits its traits
+template <>
+struct traits<Kiva::StencilOperator> : public Eigen::internal::traits<Eigen::SparseMatrix<double>> {
+};
+} // namespace internal
+} // namespace Eigen
+
+namespace Kiva {
+
+// Matrix-free seven-point stencil operator. Each row of the system is stored as the coefficients
+// of a cell and its neighbors (as produced by Cell::calcCellMatrix) in cell index order, so no
+// sparse matrix or triplet list is needed. Coefficients for dimensions with a single cell are not
+// stored.
+class LIBKIVA_EXPORT StencilOperator : public Eigen::EigenBase<StencilOperator> {
+public:
+  typedef double Scalar;
+  typedef double RealScalar;
+  typedef int StorageIndex;
+  enum {
+    ColsAtCompileTime = Eigen::Dynamic,
+    MaxColsAtCompileTime = Eigen::Dynamic,
+    IsRowMajor = false
+  };
+
+  Index rows() const { return size; }
+  Index cols() const { return size; }
+
+  template <typename Rhs>
+  Eigen::Product<StencilOperator, Rhs, Eigen::AliasFreeProduct>
+  operator*(const Eigen::MatrixBase<Rhs> &x) const {
+    return Eigen::Product<StencilOperator, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+  }
+
+  void resize(std::size_t num_cells, const std::size_t (&stepsize)[3],
+              const std::size_t (&dim_lengths)[3]);
+
+  // y += alpha*A*x
+  void multiplyAdd(double alpha, const double *x, double *y) const;
+
+  std::size_t memoryUsage() const; // bytes held by the coefficients
+
+  std::size_t size;
+  std::size_t stepsize[3];
+  std::size_t dim_lengths[3];
+
+  std::vector<double> diagonal;
+  std::vector<double> neighbor[3][2]; // [dim][0: index - stepsize, 1: index + stepsize]
+};
+
+// Preconditioner that solves the tridiagonal system of each vertical (Z) line of cells exactly,
+// neglecting coupling in the other directions. The Thomas algorithm coefficients are computed once
+// in factorize.
+class LIBKIVA_EXPORT StencilLinePreconditioner {
+public:
+  StencilLinePreconditioner() : op(nullptr), status(Eigen::Success) {}
+
+  StencilLinePreconditioner &analyzePattern(const StencilOperator &) { return *this; }
+  StencilLinePreconditioner &factorize(const StencilOperator &A);
+  StencilLinePreconditioner &compute(const StencilOperator &A) { return factorize(A); }
+
+  template <typename Rhs> Eigen::VectorXd solve(const Rhs &b) const {
+    Eigen::VectorXd x = b;
+    solveInPlace(x.data());
+    return x;
+  }
+
+  void apply(const Eigen::VectorXd &b, Eigen::VectorXd &x) const {
+    x = b;
+    solveInPlace(x.data());
+  }
+
+  Eigen::ComputationInfo info() { return status; }
+
+  std::size_t memoryUsage() const; // bytes held by the line factorization
+
+private:
+  void solveInPlace(double *x) const;
+
+  const StencilOperator *op;
+  std::vector<double> upperFactor; // modified super-diagonal (c')
+  std::vector<double> invPivot;    // inverse of the modified diagonal
+  Eigen::ComputationInfo status;
+};
+
+} // namespace Kiva
+
+namespace Eigen {
+namespace internal {
+// Product of a StencilOperator with a dense vector (used by the iterative solvers)
+template <typename Rhs>
+struct generic_product_impl<Kiva::StencilOperator, Rhs, SparseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<Kiva::StencilOperator, Rhs,
+                                generic_product_impl<Kiva::StencilOperator, Rhs>> {
+  typedef typename Product<Kiva::StencilOperator, Rhs>::Scalar Scalar;
+
+  template <typename Dest>
+  static void scaleAndAddTo(Dest &dst, const Kiva::StencilOperator &lhs, const Rhs &rhs,
+                            const Scalar &alpha) {
+    Eigen::Ref<const Eigen::VectorXd> x(rhs);
+    Eigen::Ref<Eigen::VectorXd> y(dst);
+    lhs.multiplyAdd(alpha, x.data(), y.data());
+  }
+};
+} // namespace internal
+} // namespace Eigen
+
+#endif
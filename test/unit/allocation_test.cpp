@@ -0,0 +1,162 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+// Built as its own executable (kiva_allocation_tests) because it interposes the C allocation
+// functions. Every heap allocation, including operator new and Eigen's aligned allocations, goes
+// through malloc, calloc, realloc or the aligned variants, which forward to glibc unchanged. They
+// are only counted while an AllocationCounter is in scope.
+
+#include "fixtures/bestest-fixture.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *p, std::size_t size);
+void *__libc_memalign(std::size_t alignment, std::size_t size);
+}
+
+static std::atomic<bool> countAllocations(false);
+static std::atomic<std::size_t> allocationCount(0);
+
+static void countAllocation() {
+  if (countAllocations) {
+    allocationCount++;
+  }
+}
+
+extern "C" {
+void *malloc(std::size_t size) {
+  countAllocation();
+  return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size) {
+  countAllocation();
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *p, std::size_t size) {
+  countAllocation();
+  return __libc_realloc(p, size);
+}
+
+void *memalign(std::size_t alignment, std::size_t size) {
+  countAllocation();
+  return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(std::size_t alignment, std::size_t size) {
+  countAllocation();
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **p, std::size_t alignment, std::size_t size) {
+  countAllocation();
+  *p = __libc_memalign(alignment, size);
+  return *p ? 0 : 12; // ENOMEM
+}
+}
+
+// Counts the allocations of every thread (including OpenMP workers) during its lifetime
+class AllocationCounter {
+public:
+  AllocationCounter() : start(allocationCount) { countAllocations = true; }
+  ~AllocationCounter() { countAllocations = false; }
+  std::size_t count() const { return allocationCount - start; }
+
+private:
+  std::size_t start;
+};
+
+class AllocationFixture : public GC10aFixture {
+protected:
+  // Number of allocations made by `nsteps` calls to calculate and calculateSurfaceAverages after the
+  // first `warmupSteps`
+  std::size_t countStepAllocations(std::size_t warmupSteps = 2, std::size_t nsteps = 5) {
+    init();
+    for (std::size_t i = 0; i < warmupSteps; i++) {
+      step(i);
+    }
+    AllocationCounter counter;
+    for (std::size_t i = warmupSteps; i < warmupSteps + nsteps; i++) {
+      step(i);
+    }
+    return counter.count();
+  }
+
+  void step(std::size_t i) {
+    bcs.outdoorTemp = 273 + dbt[i % 24];
+    ground->calculate(bcs, 3600.0);
+    ground->calculateSurfaceAverages();
+  }
+
+  void setCapturingConvection() {
+    // Ground copies the boundary conditions on each step. A callable that only captures a pointer
+    // fits in std::function's local storage, so copying it does not allocate.
+    const double *coefficients = convectionCoefficients;
+    bcs.slabConvectionAlgorithm = [coefficients](double, double, double, double, double) {
+      return coefficients[0] + coefficients[1] + coefficients[2] + coefficients[3];
+    };
+  }
+
+  double convectionCoefficients[4]{2.0, 0.0, 0.0, 0.0};
+};
+
+TEST_F(AllocationFixture, counter) {
+  AllocationCounter counter;
+  std::vector<double> v(10);
+  Eigen::VectorXd x(10);
+  EXPECT_EQ(counter.count(), 2u);
+}
+
+TEST_F(AllocationFixture, calculateADE) {
+  fnd.numericalScheme = Foundation::NS_ADE;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, calculateADI) {
+  fnd.numericalScheme = Foundation::NS_ADI;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, calculateExplicit) {
+  fnd.numericalScheme = Foundation::NS_EXPLICIT;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, calculateImplicit) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, calculateCrankN) {
+  fnd.numericalScheme = Foundation::NS_CRANK_NICOLSON;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, calculateImplicitMatrixFree) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_BICGSTAB_MATRIX_FREE;
+  setCapturingConvection();
+  EXPECT_EQ(countStepAllocations(), 0u);
+}
+
+TEST_F(AllocationFixture, swapTemperatures) {
+  fnd.numericalScheme = Foundation::NS_ADE;
+  init();
+  const double *TNew = ground->TNew.data();
+  const double *TOld = ground->TOld.data();
+  ground->calculate(bcs, 3600.0);
+  // The buffers are exchanged rather than copied
+  EXPECT_EQ(ground->TOld.data(), TNew);
+  EXPECT_EQ(ground->TNew.data(), TOld);
+}
@@ -30,10 +30,6 @@ TEST_F(DomainFixture, domain_basics) {
   EXPECT_EQ(domain->stepsize[0], 1u);
   EXPECT_EQ(domain->stepsize[1], 41u);
   EXPECT_EQ(domain->stepsize[2], 41u);
-
-  EXPECT_EQ(domain->dest_index_vector.size(), 3u);
-  EXPECT_EQ(domain->dest_index_vector[2].size(),
-            domain->dim_lengths[0] * domain->dim_lengths[1] * domain->dim_lengths[2]);
 }
 
 TEST_F(DomainFixture, surface_indices) {
@@ -52,6 +48,41 @@ TEST_F(DomainFixture, cell_vector) {
   EXPECT_EQ(domain->cell.size(),
             domain->dim_lengths[0] * domain->dim_lengths[1] * domain->dim_lengths[2]);
 
-  EXPECT_EQ(domain->cell[0]->cellType, CellType::BOUNDARY);
-  EXPECT_EQ(domain->cell[49]->cellType, CellType::NORMAL);
+  EXPECT_EQ(domain->cell[0]->cellType(), CellType::BOUNDARY);
+  EXPECT_EQ(domain->cell[49]->cellType(), CellType::NORMAL);
+}
+
+TEST_F(DomainFixture, cell_partitions) {
+  std::vector<int> visits(domain->cell.size(), 0);
+  for (const auto &partition : domain->cellPartitions) {
+    for (auto index : partition.indices) {
+      visits[index]++;
+      EXPECT_EQ(domain->cell[index]->cellType(), partition.cellType);
+      if (partition.cellType == CellType::BOUNDARY) {
+        EXPECT_EQ(domain->cell[index]->surfacePtr()->boundaryConditionType,
+                  partition.boundaryConditionType);
+        EXPECT_EQ(domain->cell[index]->surfacePtr()->orientation, partition.orientation);
+      }
+    }
+  }
+  EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), static_cast<long>(visits.size()));
+  EXPECT_EQ(domain->cellPartitions[0].cellType, CellType::NORMAL);
+}
+
+TEST_F(DomainFixture, active_cells) {
+  std::size_t numFixed = 0;
+  for (const auto &partition : domain->cellPartitions) {
+    for (auto index : partition.indices) {
+      EXPECT_EQ(domain->activeIndex[index] == INACTIVE_CELL, partition.isFixedTemperature());
+    }
+    if (partition.isFixedTemperature()) {
+      numFixed += partition.indices.size();
+    }
+  }
+  // The deep ground boundary is at a fixed temperature
+  EXPECT_GT(numFixed, 0u);
+  EXPECT_EQ(domain->activeCells.size() + numFixed, domain->cell.size());
+  for (std::size_t row = 0; row < domain->activeCells.size(); row++) {
+    EXPECT_EQ(domain->activeIndex[domain->activeCells[row]], row);
+  }
 }
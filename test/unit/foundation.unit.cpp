@@ -199,7 +199,7 @@ TEST_F(GC10aFixture, calculateADI) {
   } else {
     double surface_avg = calculate();
     Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
-    EXPECT_NEAR(surface_avg, 2607.32, 0.01);
+    EXPECT_NEAR(surface_avg, 2611.56, 0.01);
   }
 }
 
@@ -208,7 +208,73 @@ TEST_F(GC10aFixture, calculateImplicit) {
 
   double surface_avg = calculate();
   Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
-  EXPECT_NEAR(surface_avg, 2601.25, 0.01);
+  EXPECT_NEAR(surface_avg, 2605.52, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitReusedPreconditioner) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.preconditionerRefreshInterval = 24;
+  fnd.preconditionerIterationGrowth = 2.0;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2605.52, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitSparseLU) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_SPARSE_LU;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2611.18, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitGMRES) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_GMRES_ILUT;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2611.18, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitJacobi) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_BICGSTAB_JACOBI;
+  fnd.tolerance = 1.0e-12;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2611.18, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitMatrixFree) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_BICGSTAB_MATRIX_FREE;
+  fnd.tolerance = 1.0e-14;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2611.18, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateImplicitMultigrid) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.linearSolver = Foundation::LS_BICGSTAB_MULTIGRID;
+  fnd.tolerance = 1.0e-14;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2611.18, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateExplicit) {
+  fnd.numericalScheme = Foundation::NS_EXPLICIT;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2615.63, 0.01);
 }
 
 TEST_F(GC10aFixture, calculateCrankN) {
@@ -216,7 +282,7 @@ TEST_F(GC10aFixture, calculateCrankN) {
 
   double surface_avg = calculate();
   Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
-  EXPECT_NEAR(surface_avg, 2600.87, 0.01);
+  EXPECT_NEAR(surface_avg, 2605.13, 0.01);
 }
 
 TEST_F(GC10aFixture, calculateADE) {
@@ -224,7 +290,7 @@ TEST_F(GC10aFixture, calculateADE) {
 
   double surface_avg = calculate();
   Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
-  EXPECT_NEAR(surface_avg, 2615.19, 0.01);
+  EXPECT_NEAR(surface_avg, 2619.43, 0.01);
 }
 
 TEST_F(GC10aFixture, GC10a_calculateSteadyState) {
@@ -232,7 +298,37 @@ TEST_F(GC10aFixture, GC10a_calculateSteadyState) {
 
   double surface_avg = calculate();
   Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
-  EXPECT_NEAR(surface_avg, 3107.57, 0.01);
+  EXPECT_NEAR(surface_avg, 3107.80, 0.01);
+}
+
+// The expected values above depend on where the default solver tolerance stops the steady-state
+// initialization. Converged values do not depend on which cells are in the linear system.
+TEST_F(GC10aFixture, GC10a_calculateSteadyStateConverged) {
+  fnd.numericalScheme = Foundation::NS_STEADY_STATE;
+  fnd.tolerance = 1.0e-12;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 3107.59, 0.01);
+}
+
+TEST_F(GC10aFixture, calculateADEConvergedInitialization) {
+  fnd.numericalScheme = Foundation::NS_ADE;
+  fnd.tolerance = 1.0e-12;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 2615.03, 0.01);
+}
+
+TEST_F(GC10aFixture, GC10a_calculateSteadyStateMultigrid) {
+  fnd.numericalScheme = Foundation::NS_STEADY_STATE;
+  fnd.linearSolver = Foundation::LS_BICGSTAB_MULTIGRID;
+  fnd.tolerance = 1.0e-14;
+
+  double surface_avg = calculate();
+  Kiva::showMessage(MSG_INFO, dbl_to_string(surface_avg));
+  EXPECT_NEAR(surface_avg, 3107.59, 0.01);
 }
 
 TEST_F(AggregatorFixture, validation) {
@@ -0,0 +1,66 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#include "Functions.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace Kiva;
+
+TEST(FunctionsTest, solveTDMBatch) {
+  // Enough lanes to exercise the vector kernels and a ragged remainder
+  const std::size_t N = 9, lanes = 11, stride = 13;
+  std::vector<double> a1(N * stride), a2(N * stride), a3(N * stride), b(N * stride),
+      x(N * stride, 0.0);
+  for (std::size_t p = 0; p < N * stride; ++p) {
+    a1[p] = -0.3 - 0.01 * (p % 7);
+    a3[p] = -0.2 - 0.02 * (p % 5);
+    a2[p] = 1.0 - a1[p] - a3[p];
+    b[p] = 280.0 + 0.5 * (p % 11);
+  }
+
+  std::vector<std::vector<double>> expected(lanes);
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    std::vector<double> l1(N), l2(N), l3(N), lb(N);
+    for (std::size_t i = 0; i < N; ++i) {
+      l1[i] = a1[i * stride + lane];
+      l2[i] = a2[i * stride + lane];
+      l3[i] = a3[i * stride + lane];
+      lb[i] = b[i * stride + lane];
+    }
+    expected[lane].resize(N);
+    solveTDM(l1, l2, l3, lb, expected[lane]);
+  }
+
+  solveTDMBatch(&a1[0], &a2[0], &a3[0], &b[0], &x[0], N, stride, lanes);
+
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    for (std::size_t i = 0; i < N; ++i) {
+      EXPECT_NEAR(x[i * stride + lane], expected[lane][i], 1e-10);
+    }
+  }
+  // Lanes beyond the batch are untouched
+  EXPECT_EQ(x[stride - 1], 0.0);
+}
+
+TEST(FunctionsTest, interleavedLineIndex) {
+  // A ragged last group of lines
+  const std::size_t lineLength = 5, numLines = 2 * tdmBatchWidth() + 1;
+  std::vector<bool> used(lineLength * numLines, false);
+  for (std::size_t line = 0; line < numLines; ++line) {
+    const std::size_t groupStart = line - line % tdmBatchWidth();
+    const std::size_t groupWidth = std::min(tdmBatchWidth(), numLines - groupStart);
+    for (std::size_t position = 0; position < lineLength; ++position) {
+      const std::size_t index = interleavedLineIndex(line, position, lineLength, numLines);
+      // Each group stays in the place of its lines, with consecutive positions a group apart
+      EXPECT_GE(index, groupStart * lineLength);
+      EXPECT_LT(index, (groupStart + groupWidth) * lineLength);
+      if (position > 0) {
+        EXPECT_EQ(index, interleavedLineIndex(line, position - 1, lineLength, numLines) + groupWidth);
+      }
+      ASSERT_LT(index, used.size());
+      EXPECT_FALSE(used[index]);
+      used[index] = true;
+    }
+  }
+}
@@ -0,0 +1,323 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#include "fixtures/bestest-fixture.hpp"
+#include "fixtures/typical-fixture.hpp"
+
+#include "Aggregator.hpp"
+
+#include <sstream>
+
+using namespace Kiva;
+
+static std::size_t componentBytes(const MemoryReport &report, const std::string &component) {
+  for (auto &entry : report.components) {
+    if (entry.first == component) {
+      return entry.second;
+    }
+  }
+  ADD_FAILURE() << "Missing component: " << component;
+  return 0;
+}
+
+TEST_F(GC10aFixture, memoryReport) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  init();
+  ground->calculate(bcs, 3600.0);
+  MemoryReport report = ground->memoryReport();
+  EXPECT_EQ(componentBytes(report, "Temperatures"), 2 * ground->num_cells * sizeof(double));
+  EXPECT_GT(componentBytes(report, "Cells"), 0u);
+  EXPECT_GT(componentBytes(report, "Matrix"), 0u);
+  EXPECT_GT(componentBytes(report, "Linear solver"), 0u);
+  // Only the ADE and ADI schemes cache stencil coefficients
+  EXPECT_EQ(componentBytes(report, "Stencil coefficients"), 0u);
+
+  // Nothing is allocated by further timesteps
+  ground->calculate(bcs, 3600.0);
+  EXPECT_EQ(ground->memoryReport().total(), report.total());
+
+  Aggregator aggregator;
+  aggregator.add_instance(ground.get(), 0.5);
+  aggregator.add_instance(ground.get(), 0.5);
+  MemoryReport aggregate = aggregator.memoryReport();
+  EXPECT_EQ(aggregate.components.size(), report.components.size());
+  EXPECT_EQ(aggregate.total(), 2 * report.total());
+}
+
+TEST_F(GC10aFixture, memoryReportWithoutMatrix) {
+  fnd.numericalScheme = Foundation::NS_ADE;
+  init();
+  // The system assembled by the steady-state initialization is released by the first ADE timestep
+  EXPECT_GT(componentBytes(ground->memoryReport(), "Matrix"), 0u);
+  ground->calculate(bcs, 3600.0);
+  MemoryReport report = ground->memoryReport();
+  EXPECT_EQ(componentBytes(report, "Matrix"), Kiva::memoryUsage(Eigen::SparseMatrix<double>()));
+  EXPECT_GT(componentBytes(report, "Stencil coefficients"), 0u);
+}
+
+TEST_F(GC10aFixture, calculateAdaptive) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  init();
+  auto steadyT = ground->TNew;
+  const double duration = 30 * 24 * 3600.0;
+
+  // Response to a step change in outdoor temperature from steady state, with hourly steps
+  bcs.outdoorTemp = 273.15;
+  for (double t = 0.0; t < duration; t += 3600.0) {
+    ground->calculate(bcs, 3600.0);
+  }
+  ground->calculateSurfaceAverages();
+  double fixedFlux = ground->getSurfaceAverageValue(Surface::ST_SLAB_CORE, GroundOutput::OT_FLUX);
+
+  // Same response with steps of at least an hour
+  ground->setInitialTemperatures(steadyT);
+  Ground::BoundaryConditionsFunction boundaryConditionsAt = [this](double) -> BoundaryConditions & {
+    return bcs;
+  };
+  std::size_t steps = 0;
+  for (double t = 0.0; t < duration; steps++) {
+    t += ground->calculateAdaptive(boundaryConditionsAt, 3600.0, duration - t);
+  }
+  double adaptiveFlux =
+      ground->getSurfaceAverageValue(Surface::ST_SLAB_CORE, GroundOutput::OT_FLUX);
+
+  EXPECT_NEAR(adaptiveFlux, fixedFlux, fnd.adaptiveTimestepTolerance);
+  EXPECT_LT(steps, 720u / 4);
+}
+
+TEST_F(GC10aFixture, calculatePeriodic) {
+  fnd.numericalScheme = Foundation::NS_CRANK_NICOLSON;
+  fnd.tolerance = 1.0e-10;
+  init(); // steady state for the mean outdoor temperature
+  const double period = 24 * 3600.0;
+  const double timestep = 600.0;
+  const double w = 8.0 * std::atan(1.0) / period;
+  auto outdoorTemp = [=](double t) { return 283.15 + 10.0 * std::sin(w * t); };
+
+  // Settle into the periodic response
+  for (double t = timestep; t <= 20 * period; t += timestep) {
+    bcs.outdoorTemp = outdoorTemp(t);
+    ground->calculate(bcs, timestep);
+  }
+  std::vector<double> settled = ground->TNew;
+
+  Ground::BoundaryConditionsFunction boundaryConditionsAt = [&](double t) -> BoundaryConditions & {
+    bcs.outdoorTemp = outdoorTemp(t);
+    return bcs;
+  };
+  ground->calculatePeriodic(boundaryConditionsAt, period, 144, 3);
+
+  double maxDifference = 0.0;
+  for (std::size_t index = 0; index < settled.size(); index++) {
+    maxDifference = std::max(maxDifference, std::fabs(ground->TNew[index] - settled[index]));
+  }
+  EXPECT_LT(maxDifference, 0.05);
+}
+
+TEST_F(GC10aFixture, interpolateTemperatures) {
+  Foundation coarseFnd = fnd; // copied before its domain is built
+  coarseFnd.mesh.minCellDim *= 3.0;
+  init();
+  Ground coarseGround(coarseFnd, outputMap);
+  coarseGround.buildDomain();
+  ASSERT_LT(coarseGround.num_cells, ground->num_cells);
+
+  // A linear field is reproduced between the outermost coarse cell centers
+  auto field = [](double x, double z) { return 283.15 + 0.5 * x - 2.0 * z; };
+  const std::vector<double> &xCoarse = coarseGround.domain.mesh[0].centers;
+  const std::vector<double> &zCoarse = coarseGround.domain.mesh[2].centers;
+  std::vector<double> coarseT(coarseGround.num_cells);
+  for (std::size_t k = 0; k < coarseGround.nZ; k++) {
+    for (std::size_t i = 0; i < coarseGround.nX; i++) {
+      coarseT[i + coarseGround.nX * k] = field(xCoarse[i], zCoarse[k]);
+    }
+  }
+  coarseGround.setInitialTemperatures(coarseT);
+  ground->interpolateTemperatures(coarseGround);
+
+  const std::vector<double> &x = ground->domain.mesh[0].centers;
+  const std::vector<double> &z = ground->domain.mesh[2].centers;
+  std::size_t numChecked = 0;
+  for (std::size_t k = 0; k < ground->nZ; k++) {
+    for (std::size_t i = 0; i < ground->nX; i++) {
+      if (x[i] >= xCoarse.front() && x[i] <= xCoarse.back() && z[k] >= zCoarse.front() &&
+          z[k] <= zCoarse.back()) {
+        EXPECT_NEAR(ground->TNew[i + ground->nX * k], field(x[i], z[k]), 1.0e-9);
+        numChecked++;
+      }
+    }
+  }
+  EXPECT_GT(numChecked, ground->num_cells / 2);
+  EXPECT_EQ(ground->TOld, ground->TNew);
+}
+
+TEST_F(GC10aFixture, writeAndReadState) {
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  init();
+  auto outdoorTemp = [](int step) { return 273.15 + 10.0 * std::sin(0.3 * step); };
+  for (int step = 0; step < 12; step++) {
+    bcs.outdoorTemp = outdoorTemp(step);
+    ground->calculate(bcs, 3600.0);
+  }
+  std::stringstream state;
+  ground->writeState(state);
+
+  auto continueRun = [&]() {
+    for (int step = 12; step < 24; step++) {
+      bcs.outdoorTemp = outdoorTemp(step);
+      ground->calculate(bcs, 3600.0);
+    }
+    ground->calculateSurfaceAverages();
+    return ground->getSurfaceAverageValue(Surface::ST_SLAB_CORE, GroundOutput::OT_FLUX);
+  };
+  double flux = continueRun();
+  std::vector<double> T = ground->TNew;
+
+  // The restored run repeats the continued run exactly
+  BoundaryConditions restoredBcs;
+  ground->readState(state, restoredBcs);
+  EXPECT_EQ(restoredBcs.outdoorTemp, outdoorTemp(11));
+  EXPECT_EQ(continueRun(), flux);
+  EXPECT_EQ(ground->TNew, T);
+}
+
+TEST_F(TypicalFixture, writeAndReadStateReusedPreconditioner) {
+  // Surface convection changes the matrix on every step, so a preconditioner computed for an
+  // earlier matrix is reused until the refresh interval
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.preconditionerRefreshInterval = 5;
+  Foundation restoredFnd = fnd; // copied before its domain is built
+  bcs.slabConvectiveTemp = bcs.wallConvectiveTemp = bcs.slabRadiantTemp = bcs.wallRadiantTemp =
+      295.15;
+  init();
+  auto step = [&](Ground &g, int n) {
+    bcs.outdoorTemp = 273.15 + 10.0 * std::sin(0.3 * n);
+    bcs.localWindSpeed = 2.0 + std::cos(0.5 * n);
+    g.calculate(bcs, 3600.0);
+  };
+  // The checkpoint falls between refreshes of the preconditioner
+  for (int n = 0; n < 12; n++) {
+    step(*ground, n);
+  }
+  std::stringstream state;
+  ground->writeState(state);
+  for (int n = 12; n < 24; n++) {
+    step(*ground, n);
+  }
+
+  // A new instance restored from the state repeats the continued run exactly
+  Ground restored(restoredFnd, outputMap);
+  restored.buildDomain();
+  BoundaryConditions restoredBcs = bcs;
+  restored.readState(state, restoredBcs);
+  for (int n = 12; n < 24; n++) {
+    step(restored, n);
+  }
+  EXPECT_EQ(restored.TNew, ground->TNew);
+}
+
+TEST_F(TypicalFixture, writeAndReadStateAdaptive) {
+  // Adaptive steps keep a reused preconditioner for each step length
+  fnd.numericalScheme = Foundation::NS_IMPLICIT;
+  fnd.preconditionerRefreshInterval = 20;
+  outputMap = {Surface::ST_SLAB_CORE}; // for the error estimates
+  Foundation restoredFnd = fnd; // copied before its domain is built
+  bcs.slabConvectiveTemp = bcs.wallConvectiveTemp = bcs.slabRadiantTemp = bcs.wallRadiantTemp =
+      295.15;
+  init();
+  double t = 0.0;
+  auto run = [&](Ground &g, double duration) {
+    Ground::BoundaryConditionsFunction boundaryConditionsAt =
+        [&](double offset) -> BoundaryConditions & {
+      bcs.outdoorTemp = 273.15 + 10.0 * std::sin((t + offset) / 14000.0);
+      // A step change after the checkpoint shortens the steps again
+      bcs.slabConvectiveTemp = bcs.slabRadiantTemp = t + offset > 3 * 86400.0 ? 305.15 : 295.15;
+      bcs.localWindSpeed = 2.0 + std::cos((t + offset) / 7000.0);
+      return bcs;
+    };
+    while (t < duration) {
+      t += g.calculateAdaptive(boundaryConditionsAt, 900.0, 4 * 3600.0);
+    }
+  };
+  run(*ground, 2 * 86400.0);
+  const double tCheckpoint = t;
+  std::stringstream state;
+  ground->writeState(state);
+  run(*ground, 4 * 86400.0);
+
+  // A new instance restored from the state repeats the continued run exactly
+  Ground restored(restoredFnd, outputMap);
+  restored.buildDomain();
+  BoundaryConditions restoredBcs = bcs;
+  restored.readState(state, restoredBcs);
+  t = tCheckpoint;
+  run(restored, 4 * 86400.0);
+  EXPECT_EQ(restored.TNew, ground->TNew);
+}
+
+TEST_F(TypicalFixture, calculateExplicitStability) {
+  // The domain has zero-thickness and boundary cells with smaller stable timesteps than the soil
+  fnd.numericalScheme = Foundation::NS_EXPLICIT;
+  Foundation implicitFnd = fnd; // copied before its domain is built
+  implicitFnd.numericalScheme = Foundation::NS_IMPLICIT;
+  implicitFnd.linearSolver = Foundation::LS_SPARSE_LU;
+  bcs.slabConvectiveTemp = bcs.wallConvectiveTemp = bcs.slabRadiantTemp = bcs.wallRadiantTemp =
+      295.15;
+  init();
+  Ground implicitGround(implicitFnd, outputMap);
+  implicitGround.buildDomain();
+  implicitGround.setInitialTemperatures(ground->TNew);
+
+  for (int step = 0; step < 48; step++) {
+    bcs.outdoorTemp = 273.15 + 10.0 * std::sin(0.26 * step);
+    ground->calculate(bcs, 3600.0);
+    implicitGround.calculate(bcs, 3600.0);
+  }
+  for (std::size_t index = 0; index < ground->num_cells; index++) {
+    EXPECT_NEAR(ground->TNew[index], implicitGround.TNew[index], 0.1);
+  }
+}
+
+TEST_F(GC10aFixture, outputValuesMapInterface) {
+  init();
+  ground->calculateSurfaceAverages();
+  GroundOutput::OutputValues &outputs = ground->groundOutput.outputValues;
+  const std::pair<Surface::SurfaceType, GroundOutput::OutputType> key{Surface::ST_SLAB_CORE,
+                                                                      GroundOutput::OT_RATE};
+
+  EXPECT_EQ(outputs.at(key), outputs[key]);
+  EXPECT_EQ(outputs.count(key), 1u);
+  EXPECT_THROW(outputs.at({Surface::ST_SLAB_CORE, GroundOutput::OutputType(99)}),
+               std::out_of_range);
+  EXPECT_EQ(outputs.count({Surface::ST_SLAB_CORE, GroundOutput::OutputType(99)}), 0u);
+
+  auto it = outputs.find(key);
+  ASSERT_TRUE(it != outputs.end());
+  EXPECT_EQ(it->first, key);
+  EXPECT_EQ(it->second, outputs[key]);
+  it->second = 1.0;
+  EXPECT_EQ(outputs[key], 1.0);
+
+  // Keys are visited in the order of the map
+  std::size_t numOutputs = 0;
+  std::pair<Surface::SurfaceType, GroundOutput::OutputType> previous;
+  for (const auto &output : outputs) {
+    if (numOutputs > 0) {
+      EXPECT_LT(previous, output.first);
+    }
+    EXPECT_EQ(output.second, outputs[output.first]);
+    previous = output.first;
+    numOutputs++;
+  }
+  EXPECT_EQ(numOutputs, Surface::NUM_SURFACE_TYPES * GroundOutput::NUM_OUTPUT_TYPES);
+
+  const SurfaceTypeArray<double> &areas = ground->foundation.surfaceAreas;
+  EXPECT_EQ(areas.at(Surface::ST_SLAB_CORE), areas[Surface::ST_SLAB_CORE]);
+  EXPECT_EQ(areas.count(Surface::ST_SLAB_CORE), 1u);
+  EXPECT_EQ(areas.find(Surface::ST_SLAB_CORE)->second, areas[Surface::ST_SLAB_CORE]);
+  double totalArea = 0.0;
+  for (const auto &area : areas) {
+    totalArea += area.second;
+  }
+  EXPECT_GT(totalArea, areas[Surface::ST_SLAB_CORE]);
+}
@@ -0,0 +1,56 @@
+/* Copyright (c) 2012-2019 Big Ladder Software LLC. All rights reserved.
+ * See the LICENSE file for additional terms and conditions. */
+
+#include "StateCache.hpp"
+
+#include <gtest/gtest.h>
+
+class StateCacheFixture : public testing::Test {
+protected:
+  void SetUp() {
+    directory = boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("kiva-state-cache-%%%%-%%%%");
+  }
+
+  void TearDown() {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(directory, ec);
+  }
+
+  boost::filesystem::path directory;
+};
+
+TEST_F(StateCacheFixture, storeAndLoad) {
+  StateCache cache(directory.string(), 20, "test");
+  const std::vector<double> stored{283.15, 284.5, 290.0, -0.0, 1.0e-300};
+  cache.store(7, stored);
+
+  std::vector<double> T(stored.size());
+  ASSERT_TRUE(cache.load(7, T));
+  for (std::size_t i = 0; i < T.size(); i++) {
+    EXPECT_EQ(T[i], stored[i]);
+  }
+
+  // Another key, or another number of cells, is not the same state
+  std::vector<double> other(stored.size(), 0.0);
+  EXPECT_FALSE(cache.load(8, other));
+  std::vector<double> smaller(stored.size() - 1, 0.0);
+  EXPECT_FALSE(cache.load(7, smaller));
+  std::vector<double> empty;
+  EXPECT_FALSE(cache.load(7, empty));
+  EXPECT_EQ(other, std::vector<double>(stored.size(), 0.0));
+}
+
+TEST_F(StateCacheFixture, evictLeastRecentlyUsed) {
+  StateCache cache(directory.string(), 2, "test");
+  const std::vector<double> stored{283.15, 284.5};
+  cache.store(1, stored);
+  cache.store(2, stored);
+  cache.store(3, stored);
+
+  std::vector<double> T(stored.size());
+  EXPECT_TRUE(cache.load(3, T));
+  EXPECT_EQ(std::distance(boost::filesystem::directory_iterator(directory),
+                          boost::filesystem::directory_iterator()),
+            2);
+}